@@ -0,0 +1,56 @@
+/****************************************************************************
+File: AttributeState.cpp
+Author: fookenCode
+****************************************************************************/
+#include "AttributeState.h"
+
+// ANSI colours are RGB ordered, Win32 colour bits are BGR ordered
+static const char ANSI_COLOR_DIGIT[8] = { '0', '4', '2', '6', '1', '5', '3', '7' };
+
+/****************************************************************************
+Function: EmitTransition
+Parameter(s): unsigned char - Attribute the next cell needs
+              FrameOutputBuffer & - Arena the sequence is appended to
+Output: N/A
+Comments: Writes the shortest SGR sequence that moves the terminal from
+          the tracked attribute to the requested one.
+****************************************************************************/
+void AttributeState::EmitTransition(unsigned char attribute, FrameOutputBuffer &output) {
+    output.Append("\033[", 2);
+
+    if (mCurrentAttribute == UNKNOWN_ATTRIBUTE || ((mCurrentAttribute & 0x8) && !(attribute & 0x8))) {
+        // SGR cannot switch bold off on its own everywhere, so start clean
+        output.Append("0;3", 3);
+        output.Append(ANSI_COLOR_DIGIT[attribute & 0x7]);
+        output.Append(";4", 2);
+        output.Append(ANSI_COLOR_DIGIT[(attribute >> 4) & 0x7]);
+        if (attribute & 0x8) {
+            output.Append(";1", 2);
+        }
+    }
+    else {
+        bool needSeparator = false;
+        if ((mCurrentAttribute ^ attribute) & 0x7) {
+            output.Append('3');
+            output.Append(ANSI_COLOR_DIGIT[attribute & 0x7]);
+            needSeparator = true;
+        }
+        if ((mCurrentAttribute ^ attribute) & 0x70) {
+            if (needSeparator) {
+                output.Append(';');
+            }
+            output.Append('4');
+            output.Append(ANSI_COLOR_DIGIT[(attribute >> 4) & 0x7]);
+            needSeparator = true;
+        }
+        if ((attribute & 0x8) && !(mCurrentAttribute & 0x8)) {
+            if (needSeparator) {
+                output.Append(';');
+            }
+            output.Append('1');
+        }
+    }
+
+    output.Append('m');
+    mCurrentAttribute = attribute;
+} // END EmitTransition
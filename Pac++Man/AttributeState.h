@@ -0,0 +1,37 @@
+/****************************************************************************
+File: AttributeState.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _ATTRIBUTE_STATE_H_
+#define _ATTRIBUTE_STATE_H_
+
+#include "FrameOutputBuffer.h"
+
+/****************************************************************************
+Class: AttributeState
+Comments: Tracks the colour attribute the terminal is currently drawing
+          with and emits an SGR sequence only when a cell needs a different
+          one.  The sequence carries just the parts that changed (foreground,
+          background, brightness); a full reset is only sent when the
+          terminal state is unknown or brightness has to be switched off.
+****************************************************************************/
+class AttributeState {
+private:
+    unsigned mCurrentAttribute;
+    const static unsigned UNKNOWN_ATTRIBUTE = 0x100;
+    // Background intensity has no ANSI equivalent and is not sent
+    const static unsigned char ANSI_ATTRIBUTE_MASK = 0x7F;
+public:
+    AttributeState() : mCurrentAttribute(UNKNOWN_ATTRIBUTE) { }
+
+    void Invalidate() { mCurrentAttribute = UNKNOWN_ATTRIBUTE; }
+    bool Matches(unsigned char attribute) { return mCurrentAttribute == (attribute & ANSI_ATTRIBUTE_MASK); }
+
+    inline void Apply(unsigned char attribute, FrameOutputBuffer &output) {
+        if ((attribute & ANSI_ATTRIBUTE_MASK) != mCurrentAttribute) {
+            EmitTransition(attribute & ANSI_ATTRIBUTE_MASK, output);
+        }
+    }
+    void EmitTransition(unsigned char attribute, FrameOutputBuffer &output);
+};
+#endif // _ATTRIBUTE_STATE_H_
@@ -0,0 +1,116 @@
+/****************************************************************************
+File: BatchRunner.cpp
+Author: fookenCode
+****************************************************************************/
+#include "BatchRunner.h"
+#include "InputPolicies.h"
+#include "PacGame.h"
+#include "WorkStealingPool.h"
+#include <chrono>
+#include <cstdio>
+
+/****************************************************************************
+Function: RunSession
+Parameter(s): const SessionConfig & - Level, seed, policy and tick limit.
+Output: SessionResult - Score, deaths and level clear data for the session.
+Comments: Plays one headless game until it is over or the tick limit is
+          reached.  Safe to call from any thread.
+****************************************************************************/
+BatchRunner::SessionResult BatchRunner::RunSession(const SessionConfig &config) {
+    SessionResult result;
+    PacGame game(nullptr, true);
+    RandomWalkInput randomInput(config.seed);
+    GreedyPelletInput greedyInput(&game);
+
+    game.setRandomSeed(config.seed);
+    game.setInputSource((config.inputPolicy == POLICY_GREEDY_PELLET) ? (InputSource *)&greedyInput : (InputSource *)&randomInput);
+    if (config.startLevel != game.mGameMap.getCurrentLevel()) {
+        game.SetStartingLevel(config.startLevel);
+    }
+
+    int previousState = game.getGameState();
+    while (result.ticksRun < config.maxTicks) {
+        game.Step();
+        result.ticksRun++;
+
+        int state = game.getGameState();
+        if (state == NEXT_LEVEL && previousState != NEXT_LEVEL) {
+            result.levelsCleared++;
+            if (result.ticksToClear == 0) {
+                result.ticksToClear = game.getGameTicks();
+            }
+        }
+        else if (state == GAME_OVER) {
+            break;
+        }
+        previousState = state;
+    }
+
+    result.score = game.mScoreBoard.getScoreTotal();
+    result.deaths = MAX_VISIBLE_LIVES - game.mLivesBoard.getLivesLeft();
+    return result;
+} // END RunSession
+
+/****************************************************************************
+Function: Run
+Parameter(s): unsigned - Worker threads to use (0 = one per core).
+Output: BatchSummary - Aggregate of every session in the batch.
+Comments: Sessions are spread over a work-stealing pool.  Each session
+          writes only its own result slot, so the workers never contend on
+          results; the summary is built after all of them finish.
+****************************************************************************/
+BatchRunner::BatchSummary BatchRunner::Run(unsigned workerCount) {
+    BatchSummary summary;
+    WorkStealingPool pool(workerCount);
+    mResults.assign(mSessions.size(), SessionResult());
+
+    for (size_t i = 0; i < mSessions.size(); ++i) {
+        pool.Submit([this, i]() {
+            mResults[i] = RunSession(mSessions[i]);
+        });
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    pool.RunToCompletion();
+    summary.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    summary.workers = pool.getWorkerCount();
+    summary.sessions = (unsigned)mResults.size();
+    for (size_t i = 0; i < mResults.size(); ++i) {
+        const SessionResult &result = mResults[i];
+        if (i == 0 || result.score < summary.minScore) {
+            summary.minScore = result.score;
+        }
+        if (i == 0 || result.score > summary.maxScore) {
+            summary.maxScore = result.score;
+        }
+        summary.totalScore += result.score;
+        summary.totalDeaths += result.deaths;
+        summary.totalLevelsCleared += result.levelsCleared;
+        summary.totalTicks += result.ticksRun;
+        if (result.levelsCleared > 0) {
+            summary.sessionsCleared++;
+            summary.totalTicksToClear += result.ticksToClear;
+        }
+    }
+    return summary;
+} // END Run
+
+/****************************************************************************
+Function: PrintSummary
+Parameter(s): const BatchSummary & - Summary returned by Run.
+Output: N/A
+Comments: Writes the batch summary to stdout.
+****************************************************************************/
+void BatchRunner::PrintSummary(const BatchSummary &summary) {
+    double sessions = (summary.sessions > 0) ? (double)summary.sessions : 1.0;
+    printf("Sessions:        %u on %u workers in %.3f s\n", summary.sessions, summary.workers, summary.elapsedSeconds);
+    printf("Throughput:      %.0f ticks/sec (%llu ticks)\n",
+           (summary.elapsedSeconds > 0.0) ? summary.totalTicks / summary.elapsedSeconds : 0.0, summary.totalTicks);
+    printf("Score:           avg %.1f, min %ld, max %ld\n", summary.totalScore / sessions, summary.minScore, summary.maxScore);
+    printf("Deaths:          avg %.2f\n", summary.totalDeaths / sessions);
+    printf("Levels cleared:  %d (%u sessions)\n", summary.totalLevelsCleared, summary.sessionsCleared);
+    if (summary.sessionsCleared > 0) {
+        printf("Ticks to clear:  avg %.0f\n", (double)summary.totalTicksToClear / summary.sessionsCleared);
+    }
+} // END PrintSummary
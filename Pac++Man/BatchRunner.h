@@ -0,0 +1,52 @@
+/****************************************************************************
+File: BatchRunner.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _BATCH_RUNNER_H_
+#define _BATCH_RUNNER_H_
+
+#include <vector>
+#include "Constants.h"
+
+/****************************************************************************
+Class: BatchRunner
+Comments: Runs many independent headless PacGame sessions across all cores
+          and aggregates their results.  Every session owns its game, input
+          policy and seed, so sessions share no mutable state.
+****************************************************************************/
+class BatchRunner {
+public:
+    struct SessionConfig {
+        int startLevel, inputPolicy;
+        unsigned seed, maxTicks;
+        SessionConfig() : startLevel(1), inputPolicy(0), seed(1), maxTicks(DEFAULT_SESSION_TICK_LIMIT) { }
+    };
+
+    struct SessionResult {
+        long score;
+        int deaths, levelsCleared;
+        unsigned ticksRun, ticksToClear;
+        SessionResult() : score(0L), deaths(0), levelsCleared(0), ticksRun(0), ticksToClear(0) { }
+    };
+
+    struct BatchSummary {
+        unsigned sessions, sessionsCleared, workers;
+        long totalScore, minScore, maxScore;
+        int totalDeaths, totalLevelsCleared;
+        unsigned long long totalTicks, totalTicksToClear;
+        double elapsedSeconds;
+        BatchSummary() : sessions(0), sessionsCleared(0), workers(0), totalScore(0L), minScore(0L), maxScore(0L),
+                         totalDeaths(0), totalLevelsCleared(0), totalTicks(0ULL), totalTicksToClear(0ULL), elapsedSeconds(0.0) { }
+    };
+private:
+    std::vector<SessionConfig> mSessions;
+    std::vector<SessionResult> mResults;
+public:
+    void AddSession(const SessionConfig &config) { mSessions.push_back(config); }
+    const std::vector<SessionResult> &getResults() { return mResults; }
+
+    static SessionResult RunSession(const SessionConfig &config);
+    BatchSummary Run(unsigned workerCount = 0);
+    static void PrintSummary(const BatchSummary &summary);
+};
+#endif // _BATCH_RUNNER_H_
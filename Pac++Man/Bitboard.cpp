@@ -0,0 +1,175 @@
+/****************************************************************************
+File: Bitboard.cpp
+Author: fookenCode
+****************************************************************************/
+#include "Bitboard.h"
+
+/****************************************************************************
+Function: Resize
+Parameter(s): int - Number of bits (tiles) the board holds
+Output: N/A
+Comments: Clears the board.
+****************************************************************************/
+void Bitboard::Resize(int bitCount) {
+    mBitCount = bitCount;
+    mWords.assign((bitCount + WORD_BITS - 1) / WORD_BITS, 0);
+} // END Resize
+
+/****************************************************************************
+Function: AssignWords
+Parameter(s): const unsigned long long * - Packed words, as from getWords()
+              int - Number of bits (tiles) the words hold
+Output: N/A
+Comments: Used to adopt boards stored in a compiled level pack.
+****************************************************************************/
+void Bitboard::AssignWords(const unsigned long long *words, int bitCount) {
+    mBitCount = bitCount;
+    mWords.assign(words, words + (bitCount + WORD_BITS - 1) / WORD_BITS);
+    ClearUnusedBits();
+} // END AssignWords
+
+/****************************************************************************
+Function: ClearUnusedBits
+Parameter(s): N/A
+Output: N/A
+Comments: Keeps the bits past the last tile zero after a shift, so Count,
+          Any and comparisons never see them.
+****************************************************************************/
+void Bitboard::ClearUnusedBits() {
+    int usedBits = mBitCount % WORD_BITS;
+    if (usedBits != 0) {
+        mWords.back() &= (1ULL << usedBits) - 1;
+    }
+} // END ClearUnusedBits
+
+/****************************************************************************
+Function: Clear
+Parameter(s): N/A
+Output: N/A
+Comments: N/A
+****************************************************************************/
+void Bitboard::Clear() {
+    for (size_t i = 0; i < mWords.size(); ++i) {
+        mWords[i] = 0;
+    }
+} // END Clear
+
+/****************************************************************************
+Function: Count
+Parameter(s): N/A
+Output: int - Number of set tiles.
+Comments: N/A
+****************************************************************************/
+int Bitboard::Count() const {
+    int count = 0;
+    for (size_t i = 0; i < mWords.size(); ++i) {
+        count += PopCount(mWords[i]);
+    }
+    return count;
+} // END Count
+
+/****************************************************************************
+Function: Any
+Parameter(s): N/A
+Output: bool - Whether any tile is set.
+Comments: N/A
+****************************************************************************/
+bool Bitboard::Any() const {
+    for (size_t i = 0; i < mWords.size(); ++i) {
+        if (mWords[i] != 0) {
+            return true;
+        }
+    }
+    return false;
+} // END Any
+
+/****************************************************************************
+Function: AnyInRange
+Parameter(s): int - First bit index of the range
+              int - Last bit index of the range (inclusive)
+Output: bool - Whether any tile in the range is set.
+Comments: A range within one row touches at most two words.
+****************************************************************************/
+bool Bitboard::AnyInRange(int firstIndex, int lastIndex) const {
+    int firstWord = firstIndex / WORD_BITS, lastWord = lastIndex / WORD_BITS;
+    unsigned long long firstMask = ~0ULL << (firstIndex % WORD_BITS);
+    unsigned long long lastMask = ~0ULL >> (WORD_BITS - 1 - lastIndex % WORD_BITS);
+
+    if (firstWord == lastWord) {
+        return (mWords[firstWord] & firstMask & lastMask) != 0;
+    }
+    if (mWords[firstWord] & firstMask) {
+        return true;
+    }
+    for (int i = firstWord + 1; i < lastWord; ++i) {
+        if (mWords[i] != 0) {
+            return true;
+        }
+    }
+    return (mWords[lastWord] & lastMask) != 0;
+} // END AnyInRange
+
+/****************************************************************************
+Function: operator|=
+Parameter(s): const Bitboard & - Board of the same size
+Output: Bitboard & - This board, now the union of both.
+Comments: N/A
+****************************************************************************/
+Bitboard &Bitboard::operator|=(const Bitboard &other) {
+    for (size_t i = 0; i < mWords.size(); ++i) {
+        mWords[i] |= other.mWords[i];
+    }
+    return *this;
+} // END operator|=
+
+/****************************************************************************
+Function: operator&=
+Parameter(s): const Bitboard & - Board of the same size
+Output: Bitboard & - This board, now the intersection of both.
+Comments: N/A
+****************************************************************************/
+Bitboard &Bitboard::operator&=(const Bitboard &other) {
+    for (size_t i = 0; i < mWords.size(); ++i) {
+        mWords[i] &= other.mWords[i];
+    }
+    return *this;
+} // END operator&=
+
+/****************************************************************************
+Function: ShiftInto
+Parameter(s): Bitboard & - Board receiving the result (same size)
+              int - Bits to shift by; positive moves towards higher
+                    indices (right/down), negative towards lower ones
+Output: N/A
+Comments: Bits shifted past either end are dropped.  A shift by one moves
+          every tile one column, a shift by the Map width one row.
+****************************************************************************/
+void Bitboard::ShiftInto(Bitboard &result, int shift) const {
+    const int wordCount = (int)mWords.size();
+    const int wordShift = ((shift < 0) ? -shift : shift) / WORD_BITS;
+    const int bitShift = ((shift < 0) ? -shift : shift) % WORD_BITS;
+
+    for (int i = 0; i < wordCount; ++i) {
+        unsigned long long word = 0;
+        if (shift >= 0) {
+            int source = i - wordShift;
+            if (source >= 0) {
+                word = mWords[source] << bitShift;
+                if (bitShift != 0 && source > 0) {
+                    word |= mWords[source - 1] >> (WORD_BITS - bitShift);
+                }
+            }
+        }
+        else {
+            int source = i + wordShift;
+            if (source < wordCount) {
+                word = mWords[source] >> bitShift;
+                if (bitShift != 0 && source + 1 < wordCount) {
+                    word |= mWords[source + 1] << (WORD_BITS - bitShift);
+                }
+            }
+        }
+        result.mWords[i] = word;
+    }
+    result.ClearUnusedBits();
+} // END ShiftInto
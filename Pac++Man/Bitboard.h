@@ -0,0 +1,118 @@
+/****************************************************************************
+File: Bitboard.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _BITBOARD_H_
+#define _BITBOARD_H_
+
+#include <cstddef>
+#include <vector>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/****************************************************************************
+Function: PopCount
+Parameter(s): unsigned long long - Word to count
+Output: int - Number of set bits.
+Comments: N/A
+****************************************************************************/
+static inline int PopCount(unsigned long long word) {
+#if defined(_MSC_VER) && defined(_WIN64)
+    return (int)__popcnt64(word);
+#elif defined(_MSC_VER)
+    return (int)(__popcnt((unsigned)word) + __popcnt((unsigned)(word >> 32)));
+#else
+    return __builtin_popcountll(word);
+#endif
+} // END PopCount
+
+/****************************************************************************
+Function: LowestSetBit
+Parameter(s): unsigned long long - Non-zero word
+Output: int - Index of the lowest set bit.
+Comments: N/A
+****************************************************************************/
+static inline int LowestSetBit(unsigned long long word) {
+#if defined(_MSC_VER) && defined(_WIN64)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return (int)index;
+#elif defined(_MSC_VER)
+    unsigned long index;
+    if (_BitScanForward(&index, (unsigned long)word)) {
+        return (int)index;
+    }
+    _BitScanForward(&index, (unsigned long)(word >> 32));
+    return (int)index + 32;
+#else
+    return __builtin_ctzll(word);
+#endif
+} // END LowestSetBit
+
+/****************************************************************************
+Function: HighestSetBit
+Parameter(s): unsigned long long - Non-zero word
+Output: int - Index of the highest set bit.
+Comments: N/A
+****************************************************************************/
+static inline int HighestSetBit(unsigned long long word) {
+#if defined(_MSC_VER) && defined(_WIN64)
+    unsigned long index;
+    _BitScanReverse64(&index, word);
+    return (int)index;
+#elif defined(_MSC_VER)
+    unsigned long index;
+    if (_BitScanReverse(&index, (unsigned long)(word >> 32))) {
+        return (int)index + 32;
+    }
+    _BitScanReverse(&index, (unsigned long)word);
+    return (int)index;
+#else
+    return 63 - __builtin_clzll(word);
+#endif
+} // END HighestSetBit
+
+/****************************************************************************
+Class: Bitboard
+Comments: One bit per Map tile, packed row-major into 64-bit words (bit
+          index = yPos * width + xPos).  Sized once per level; none of the
+          operations allocate after that, so boards used as scratch space
+          can be kept and reused.
+****************************************************************************/
+class Bitboard {
+public:
+    const static int WORD_BITS = 64;
+private:
+    std::vector<unsigned long long> mWords;
+    int mBitCount;
+
+    void ClearUnusedBits();
+public:
+    Bitboard() : mBitCount(0) { }
+
+    void Resize(int bitCount);
+    void AssignWords(const unsigned long long *words, int bitCount);
+    int getBitCount() const { return mBitCount; }
+    int getWordCount() const { return (int)mWords.size(); }
+    const unsigned long long *getWords() const { return mWords.empty() ? nullptr : &mWords[0]; }
+    unsigned long long *getMutableWords() { return mWords.empty() ? nullptr : &mWords[0]; }
+
+    inline void Set(int index) { mWords[index / WORD_BITS] |= 1ULL << (index % WORD_BITS); }
+    inline void Reset(int index) { mWords[index / WORD_BITS] &= ~(1ULL << (index % WORD_BITS)); }
+    inline bool Test(int index) const { return (mWords[index / WORD_BITS] >> (index % WORD_BITS)) & 1; }
+    inline void Assign(int index, bool value) { value ? Set(index) : Reset(index); }
+
+    void Clear();
+    int Count() const;
+    bool Any() const;
+    bool AnyInRange(int firstIndex, int lastIndex) const;
+
+    Bitboard &operator|=(const Bitboard &other);
+    Bitboard &operator&=(const Bitboard &other);
+    bool operator==(const Bitboard &other) const { return mWords == other.mWords; }
+    bool operator!=(const Bitboard &other) const { return mWords != other.mWords; }
+
+    void ShiftInto(Bitboard &result, int shift) const;
+};
+#endif // _BITBOARD_H_
@@ -0,0 +1,216 @@
+/****************************************************************************
+File: Console.cpp
+Author: fookenCode
+****************************************************************************/
+#include "Console.h"
+#include <cstdio>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <termios.h>
+#include <unistd.h>
+#include <sys/select.h>
+#endif
+
+#ifndef _WIN32
+static struct termios originalTerminalSettings;
+static bool terminalSettingsSaved = false;
+#endif
+
+// The last stretch before a deadline is yielded away rather than slept,
+// as sleeps overshoot by up to the scheduler's timer resolution
+#ifdef _WIN32
+static const std::chrono::microseconds SLEEP_OVERSHOOT_MARGIN(2000);
+#else
+static const std::chrono::microseconds SLEEP_OVERSHOOT_MARGIN(200);
+#endif
+
+/****************************************************************************
+Function: Initialize
+Parameter(s): const char * - Title for the console window.
+Output: N/A
+Comments: Sizes the console, hides the cursor and switches the terminal
+          into a mode where the ANSI escape sequences used by the renderers
+          are honoured and key presses are delivered without buffering.
+****************************************************************************/
+void Console::Initialize(const char *title) {
+#ifdef _WIN32
+    system("cls");
+    CONSOLE_CURSOR_INFO info;
+    HANDLE hOutput = GetStdHandle(STD_OUTPUT_HANDLE);
+    COORD bufferSize = { SCREEN_BUFFER_WIDTH, SCREEN_BUFFER_HEIGHT };
+    SMALL_RECT windowDimensions = { 0, 0, SCREEN_BUFFER_WIDTH - 1, SCREEN_BUFFER_HEIGHT - 1 };
+    SetConsoleScreenBufferSize(hOutput, bufferSize);
+    SetConsoleWindowInfo(hOutput, TRUE, &windowDimensions);
+    SetConsoleTitleA(title);
+
+    DWORD outputMode = 0;
+    if (GetConsoleMode(hOutput, &outputMode)) {
+        SetConsoleMode(hOutput, outputMode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+    }
+
+    // turn the cursor off
+    info.bVisible = FALSE;
+    info.dwSize = 1;
+    SetConsoleCursorInfo(hOutput, &info);
+#else
+    if (tcgetattr(STDIN_FILENO, &originalTerminalSettings) == 0) {
+        struct termios rawSettings = originalTerminalSettings;
+        rawSettings.c_lflag &= ~(ICANON | ECHO);
+        rawSettings.c_cc[VMIN] = 0;
+        rawSettings.c_cc[VTIME] = 0;
+        tcsetattr(STDIN_FILENO, TCSANOW, &rawSettings);
+        terminalSettingsSaved = true;
+    }
+    // Set title, clear screen and hide the cursor
+    std::cout << "\033]0;" << title << "\007" << "\033[2J\033[H\033[?25l" << std::flush;
+#endif
+} // END Initialize
+
+/****************************************************************************
+Function: Shutdown
+Parameter(s): N/A
+Output: N/A
+Comments: Restores the terminal to the state it was in before Initialize.
+****************************************************************************/
+void Console::Shutdown() {
+#ifndef _WIN32
+    std::cout << "\033[0m\033[?25h" << std::flush;
+    if (terminalSettingsSaved) {
+        tcsetattr(STDIN_FILENO, TCSANOW, &originalTerminalSettings);
+        terminalSettingsSaved = false;
+    }
+#endif
+} // END Shutdown
+
+/****************************************************************************
+Function: HasFocus
+Parameter(s): N/A
+Output: bool - False when the game window is known to be in the background.
+Comments: Only Windows can tell; terminals are always treated as focused.
+****************************************************************************/
+bool Console::HasFocus() {
+#ifdef _WIN32
+    return (GetConsoleWindow() == GetForegroundWindow());
+#else
+    return true;
+#endif
+} // END HasFocus
+
+/****************************************************************************
+Function: GetMilliseconds
+Parameter(s): N/A
+Output: unsigned long - Monotonic wall-clock time in milliseconds.
+Comments: Only the interactive front-end uses wall-clock time, the game
+          simulation itself runs on ticks.
+****************************************************************************/
+unsigned long Console::GetMilliseconds() {
+    using namespace std::chrono;
+    return (unsigned long)duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+} // END GetMilliseconds
+
+/****************************************************************************
+Function: WaitForInput
+Parameter(s): unsigned long - Longest time to wait in milliseconds
+Output: bool - Whether input arrived before the timeout.
+Comments: Blocks without using any CPU until a key is pressed.  Leaves the
+          keys where they are for the next PollInput().
+****************************************************************************/
+bool Console::WaitForInput(unsigned long timeoutMilliseconds) {
+#ifdef _WIN32
+    HANDLE hInput = GetStdHandle(STD_INPUT_HANDLE);
+    bool inputArrived = (WaitForSingleObject(hInput, (DWORD)timeoutMilliseconds) == WAIT_OBJECT_0);
+    // Keys are sampled with GetAsyncKeyState; drop the queued console events
+    // so the handle is not signalled forever
+    FlushConsoleInputBuffer(hInput);
+    return inputArrived;
+#else
+    fd_set readSet;
+    struct timeval timeout;
+    timeout.tv_sec = (long)(timeoutMilliseconds / 1000);
+    timeout.tv_usec = (long)(timeoutMilliseconds % 1000) * 1000;
+    FD_ZERO(&readSet);
+    FD_SET(STDIN_FILENO, &readSet);
+    return select(STDIN_FILENO + 1, &readSet, nullptr, nullptr, &timeout) > 0;
+#endif
+} // END WaitForInput
+
+/****************************************************************************
+Function: SleepUntil
+Parameter(s): std::chrono::steady_clock::time_point - When to wake up
+Output: N/A
+Comments: Sleeps for all but SLEEP_OVERSHOOT_MARGIN of the wait and yields
+          through the rest, so frames start on time without spinning.
+****************************************************************************/
+void Console::SleepUntil(std::chrono::steady_clock::time_point deadline) {
+    if (std::chrono::steady_clock::now() < deadline - SLEEP_OVERSHOOT_MARGIN) {
+        std::this_thread::sleep_until(deadline - SLEEP_OVERSHOOT_MARGIN);
+    }
+    while (std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+} // END SleepUntil
+
+/****************************************************************************
+Function: PollInput
+Parameter(s): unsigned - Simulation tick the input is sampled for.
+Output: unsigned - GAME_INPUTS bits for every key currently pressed.
+Comments: Windows samples the key state directly, and reports the window
+          going to the background as INPUT_FOCUS_LOST_BIT.  Terminals only
+          report key presses, so each key read is reported as held for this
+          tick.
+****************************************************************************/
+unsigned ConsoleInput::PollInput(unsigned /*tick*/) {
+    unsigned inputBits = 0;
+#ifdef _WIN32
+    if (GetAsyncKeyState(VK_LEFT))                              inputBits |= INPUT_LEFT_BIT;
+    if (GetAsyncKeyState(VK_RIGHT))                             inputBits |= INPUT_RIGHT_BIT;
+    if (GetAsyncKeyState(VK_UP))                                inputBits |= INPUT_UP_BIT;
+    if (GetAsyncKeyState(VK_DOWN))                              inputBits |= INPUT_DOWN_BIT;
+    if (GetAsyncKeyState(VK_SPACE))                             inputBits |= INPUT_PAUSE_BIT;
+    if (GetAsyncKeyState(VK_ADD))                               inputBits |= INPUT_COIN_BIT;
+    if (GetAsyncKeyState(VK_NUMPAD1) || GetAsyncKeyState('1'))  inputBits |= INPUT_START_BIT;
+    if (GetAsyncKeyState(VK_ESCAPE))                            inputBits |= INPUT_QUIT_BIT;
+    if (GetAsyncKeyState('P'))                                  inputBits |= INPUT_PROFILER_BIT;
+    if (GetAsyncKeyState('T'))                                  inputBits |= INPUT_TRACE_BIT;
+    if (!Console::HasFocus())                                   inputBits |= INPUT_FOCUS_LOST_BIT;
+#else
+    fd_set readSet;
+    struct timeval noWait = { 0, 0 };
+    FD_ZERO(&readSet);
+    FD_SET(STDIN_FILENO, &readSet);
+    if (select(STDIN_FILENO + 1, &readSet, nullptr, nullptr, &noWait) <= 0) {
+        return inputBits;
+    }
+
+    char keys[64];
+    int count = (int)read(STDIN_FILENO, keys, sizeof(keys));
+    for (int i = 0; i < count; ++i) {
+        if (keys[i] == '\033' && i + 2 < count && keys[i + 1] == '[') {
+            // Arrow keys arrive as ESC [ A..D
+            switch (keys[i + 2]) {
+            case 'A': inputBits |= INPUT_UP_BIT; break;
+            case 'B': inputBits |= INPUT_DOWN_BIT; break;
+            case 'C': inputBits |= INPUT_RIGHT_BIT; break;
+            case 'D': inputBits |= INPUT_LEFT_BIT; break;
+            }
+            i += 2;
+            continue;
+        }
+
+        switch (keys[i]) {
+        case ' ':    inputBits |= INPUT_PAUSE_BIT; break;
+        case '+':    inputBits |= INPUT_COIN_BIT; break;
+        case '1':    inputBits |= INPUT_START_BIT; break;
+        case 'p':    inputBits |= INPUT_PROFILER_BIT; break;
+        case 't':    inputBits |= INPUT_TRACE_BIT; break;
+        case 'q':
+        case '\033': inputBits |= INPUT_QUIT_BIT; break;
+        }
+    }
+#endif
+    return inputBits;
+} // END PollInput
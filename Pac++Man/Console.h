@@ -0,0 +1,35 @@
+/****************************************************************************
+File: Console.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _CONSOLE_H_
+#define _CONSOLE_H_
+
+#include "InputSource.h"
+#include <chrono>
+
+/****************************************************************************
+Class: Console
+Comments: Thin platform layer over the terminal.  Everything that used to
+          call the Win32 console API directly goes through here so the rest
+          of the game builds on both Windows and POSIX terminals.
+****************************************************************************/
+class Console {
+public:
+    static void Initialize(const char *title);
+    static void Shutdown();
+    static bool HasFocus();
+    static unsigned long GetMilliseconds();
+    static bool WaitForInput(unsigned long timeoutMilliseconds);
+    static void SleepUntil(std::chrono::steady_clock::time_point deadline);
+};
+
+/****************************************************************************
+Class: ConsoleInput
+Comments: InputSource backed by the live keyboard.
+****************************************************************************/
+class ConsoleInput : public InputSource {
+public:
+    virtual unsigned PollInput(unsigned tick);
+};
+#endif // _CONSOLE_H_
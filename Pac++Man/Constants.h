@@ -11,13 +11,22 @@ enum AI_COLORS { GHOST_BLUE =(0x0008 | 0x0004 | 0x0001 | 0x0002 | 0x0010 | 0x008
 enum LEVEL_COLORS {LVL_ONE=26, LVL_TWO=78, INVALID_LEVEL};
 enum WALL_GROUPS { INNER = 0, OUTER, BOTH, INVALID_GROUP };
 enum GAME_STATE { ATTRACT = 0, PAUSED, READY, RUNNING, NEXT_LEVEL, GAME_OVER};
+enum TEXT_ATTRIBUTES { ATTR_DEFAULT = 0x07, ATTR_CREDITS_TEXT = 0x0C, ATTR_HIGHLIGHT_TEXT = 0x0E, ATTR_BOARD_TEXT = 0x0F, ATTR_INVALID = 0xFF };
+enum GAME_INPUTS { INPUT_LEFT_BIT = LEFT_BIT, INPUT_UP_BIT = UP_BIT, INPUT_RIGHT_BIT = RIGHT_BIT, INPUT_DOWN_BIT = DOWN_BIT,
+                   INPUT_PAUSE_BIT = 0x10, INPUT_COIN_BIT = 0x20, INPUT_START_BIT = 0x40, INPUT_QUIT_BIT = 0x80,
+                   INPUT_PROFILER_BIT = 0x100, INPUT_TRACE_BIT = 0x200, INPUT_FOCUS_LOST_BIT = 0x400 };
 
 const static double MOVING_ENTITY_DEFAULT_SPEED     = 2.25;
+const static int SCREEN_BUFFER_WIDTH                = 55;
+const static int SCREEN_BUFFER_HEIGHT               = 31;
 const static int SCORE_BOARD_HEIGHT_POSITION        = 2;
 const static int MAX_VISIBLE_LIVES                  = 3;
 const static int MAX_CREDITS_ALLOWED                = 99;
 const static int MAX_ENEMIES                        = 4;
-const static int DEFAULT_MAP_WIDTH                  = 37;
+const static int MAX_LEVEL_NUMBER                   = 99;
+const static int MAX_LEVEL_DIMENSION                = 1024;
+const static int LEVEL_PREFETCH_DOTS_REMAINING      = 30;
+const static int DEFAULT_MAP_WIDTH                  = 36;
 const static int DEFAULT_MAP_HEIGHT                 = 30;
 const static int DEFAULT_PLAYER_X_POSITION          = 17;
 const static int DEFAULT_PLAYER_Y_POSITION          = 22;
@@ -26,21 +35,47 @@ const static int DEFAULT_AI_X_POSITION              = 14;
 const static int AI_BOX_ACTIVE_Y_POSITION           = 11;
 const static int AI_BOX_ACTIVE_X_POSITION           = 17;
 const static int MILLISECONDS_FPS_THRESHOLD         = 16;
+const static int MILLISECONDS_PER_TICK              = MILLISECONDS_FPS_THRESHOLD;
+const static int MAX_CATCH_UP_TICKS                 = 5;
+const static int IDLE_INPUT_WAIT_MILLISECONDS       = 250;
+const static int METRICS_REPORT_INTERVAL_SECONDS    = 10;
+const static int ATTRACT_DEMO_DELAY_MILLISECONDS    = 20000;
+const static int MCTS_ITERATIONS_PER_DECISION       = 128;
+const static int STATE_TRANSITION_DELAY             = 3000;
+const static unsigned DEFAULT_SESSION_TICK_LIMIT    = 100000;
 const static int SCREEN_OFFSET_MARGIN               = 5;
 const static int LIVES_BOARD_HEIGHT_POSITION        = 6;
+const static int PROFILER_OVERLAY_HEIGHT_POSITION   = 10;
 const static int STATUS_TEXT_OFFSET_MARGIN          = SCREEN_OFFSET_MARGIN + 11;
+const static int STATUS_TEXT_HEIGHT_POSITION        = 16;
+const static int STATUS_TEXT_WIDTH                  = 15;
+const static int BOARD_VALUE_WIDTH                  = 8;
 const static int POWER_PELLET_SCORE_AMOUNT          = 50;
 const static int NORML_PELLET_SCORE_AMOUNT          = 10;
 const static int GHOST_SCORE_AMOUNT                 = 600;
 const static int GHOST_SPAWN_TIMER                  = 5000;
 const static int VULNERABILITY_TIME_LIMIT           = 4250;
-const static int VK_1                               = 0x31;
 const static char POWER_PELLET_CHARACTER            = (char)0xF9;
 const static char NORML_PELLET_CHARACTER            = (char)0xFA;
 const static char MAP_FILLER_CHARACTER              = (char)0x61;
 const static char LIVES_BOARD_CHARACTER             = (char)0x3C;
 const static char SPAWN_BOX_BARRIER_CHARACTER       = (char)0x7E;
-const static char *LEVEL_FILENAME_TEMPLATE          = "Assets\\Levels\\PacMan_Level_%d.txt";
+const static char INNER_WALL_HORIZONTAL_CHARACTER   = (char)0xC4;
+const static char INNER_WALL_VERTICAL_CHARACTER     = (char)0xB3;
+const static char INNER_WALL_TOP_LEFT_CHARACTER     = (char)0xDA;
+const static char INNER_WALL_TOP_RIGHT_CHARACTER    = (char)0xBF;
+const static char INNER_WALL_BOTTOM_LEFT_CHARACTER  = (char)0xC0;
+const static char INNER_WALL_BOTTOM_RIGHT_CHARACTER = (char)0xD9;
+const static char OUTER_WALL_HORIZONTAL_CHARACTER   = (char)0xCD;
+const static char OUTER_WALL_VERTICAL_CHARACTER     = (char)0xBA;
+const static char OUTER_WALL_TOP_LEFT_CHARACTER     = (char)0xC9;
+const static char OUTER_WALL_TOP_RIGHT_CHARACTER    = (char)0xBB;
+const static char OUTER_WALL_BOTTOM_LEFT_CHARACTER  = (char)0xC8;
+const static char OUTER_WALL_BOTTOM_RIGHT_CHARACTER = (char)0xBC;
+const static char *LEVEL_FILENAME_TEMPLATE          = "Assets/Levels/PacMan_Level_%d.txt";
+const static char *LEVEL_PACK_FILENAME              = "Assets/Levels/PacMan_Levels.pak";
+const static char *FRAME_PROFILE_FILENAME           = "FrameProfile.txt";
+const static char *TRACE_FILENAME                   = "PacTrace.json";
 const static char *SCORE_NAME_TEXT                  = "Score";
 const static char *LIVES_NAME_TEXT                  = "Lives";
 const static char *CREDITS_NAME_TEXT                = "Credits ";
@@ -1,8 +1,7 @@
 #include "CreditsBoard.h"
-#include <Windows.h>
-#include <iostream>
+#include "RenderEngine.h"
+#include <cstdio>
 CreditsBoard::CreditsBoard() : creditTotal(MAX_CREDITS_ALLOWED) {
-    setInvalidated(true);
 }
 
 CreditsBoard::~CreditsBoard() {
@@ -11,24 +10,17 @@ CreditsBoard::~CreditsBoard() {
 
 /****************************************************************************
 Function: Render
-Parameter(s): N/A
+Parameter(s): RenderEngine & - Engine whose back buffer is drawn into.
 Output: N/A
 Comments: Renders the number of Credits the Player currently has inserted
 at the bottom of the screen.
 ****************************************************************************/
-void CreditsBoard::Render() {
-    if (isInvalidated) {
-        COORD Position;
-        Position.X = (int)xPos;
-        Position.Y = (int)yPos;
-        SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), 12);
-        SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), Position);
-        std::cout << CREDITS_NAME_TEXT << creditTotal;
-        SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), 7);
-        setInvalidated(false);
-    }
+void CreditsBoard::Render(RenderEngine &engine) {
+    char creditsText[32];
+    snprintf(creditsText, sizeof(creditsText), "%s%-3d", CREDITS_NAME_TEXT, creditTotal);
+    engine.DrawString((int)xPos, (int)yPos, creditsText, ATTR_CREDITS_TEXT);
 } // END Render
 
 void CreditsBoard::Reset() {
     // no-op
-} // END Reset
\ No newline at end of file
+} // END Reset
@@ -11,11 +11,11 @@ public:
     virtual ~CreditsBoard();
 
     int getCreditTotal() { return creditTotal; }
-    void addCredits(int creditsToAdd) { creditTotal += creditsToAdd; setInvalidated(true); }
-    void setCredits(int newCreditTotal) { creditTotal = newCreditTotal; setInvalidated(true); }
-    inline void decCredits() { creditTotal--; setInvalidated(true); }
-    inline void incCredits() { creditTotal++; setInvalidated(true); }
-    virtual void Render();
+    void addCredits(int creditsToAdd) { creditTotal += creditsToAdd; }
+    void setCredits(int newCreditTotal) { creditTotal = newCreditTotal; }
+    inline void decCredits() { creditTotal--; }
+    inline void incCredits() { creditTotal++; }
+    virtual void Render(RenderEngine &engine);
     virtual void Reset();
 };
 #endif //_CREDITS_BOARD_H_
\ No newline at end of file
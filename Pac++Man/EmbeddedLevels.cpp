@@ -0,0 +1,79 @@
+/****************************************************************************
+File: EmbeddedLevels.cpp
+Author: fookenCode
+****************************************************************************/
+#include "EmbeddedLevels.h"
+#include <cstdio>
+#include <memory>
+#include "LevelData.h"
+
+/****************************************************************************
+Function: WriteStockLevelsHeader
+Parameter(s): const char * - Path of the header to write
+              int & - Receives the number of levels written
+Output: bool - Whether the header was written.
+Comments: Reads the text levels 1, 2, ... until one is missing and writes
+          their tiles, with the pellets put back, as StockLevels.h.
+****************************************************************************/
+bool WriteStockLevelsHeader(const char *filename, int &levelsWritten) {
+    levelsWritten = 0;
+    if (!LevelData::LoadText(1)) {
+        return false;
+    }
+    FILE *output = fopen(filename, "w");
+    if (output == nullptr) {
+        return false;
+    }
+
+    fprintf(output, "/****************************************************************************\n"
+                    "File: StockLevels.h\n"
+                    "Author: fookenCode\n"
+                    "Comments: Generated from the text levels by \"--embed-levels\", do not edit.\n"
+                    "****************************************************************************/\n"
+                    "#ifndef _STOCK_LEVELS_H_\n"
+                    "#define _STOCK_LEVELS_H_\n\n"
+                    "#include \"EmbeddedLevels.h\"\n");
+
+    int levelCount = 0;
+    for (int levelNumber = 1; levelNumber <= MAX_LEVEL_NUMBER; ++levelNumber) {
+        std::shared_ptr<const LevelData> level = LevelData::LoadText(levelNumber);
+        if (!level) {
+            break;
+        }
+        const int width = level->getWidth(), height = level->getHeight();
+        fprintf(output, "\nconstexpr unsigned char STOCK_LEVEL_%d_TILES[%d * %d] = {\n", levelNumber, width, height);
+        for (int i = 0; i < height; ++i) {
+            fprintf(output, "   ");
+            for (int j = 0; j < width; ++j) {
+                int boardIndex = i * width + j;
+                unsigned char tile = (unsigned char)level->getTiles()[level->TileIndex(j, i)];
+                if (level->getPelletBoard().Test(boardIndex)) {
+                    tile = (unsigned char)NORML_PELLET_CHARACTER;
+                }
+                else if (level->getPowerPelletBoard().Test(boardIndex)) {
+                    tile = (unsigned char)POWER_PELLET_CHARACTER;
+                }
+                fprintf(output, " 0x%02X,", tile);
+            }
+            fprintf(output, "\n");
+        }
+        fprintf(output, "};\n"
+                        "constexpr EmbeddedLevel<%d, %d> STOCK_LEVEL_%d = MakeEmbeddedLevel<%d, %d>(STOCK_LEVEL_%d_TILES, %d, %d);\n"
+                        "static_assert(STOCK_LEVEL_%d.totalDots == %d, \"Level %d pellet count differs from the text level\");\n",
+                width, height, levelNumber, width, height, levelNumber, level->getForeColor(), level->getBackColor(),
+                levelNumber, level->getTotalDots(), levelNumber);
+        levelCount = levelNumber;
+    }
+
+    fprintf(output, "\nstatic const EmbeddedLevelView STOCK_LEVELS[] = {\n");
+    for (int levelNumber = 1; levelNumber <= levelCount; ++levelNumber) {
+        fprintf(output, "    MakeEmbeddedLevelView(%d, STOCK_LEVEL_%d),\n", levelNumber, levelNumber);
+    }
+    fprintf(output, "};\n#endif // _STOCK_LEVELS_H_\n");
+
+    if (fclose(output) != 0) {
+        return false;
+    }
+    levelsWritten = levelCount;
+    return true;
+} // END WriteStockLevelsHeader
@@ -0,0 +1,130 @@
+/****************************************************************************
+File: EmbeddedLevels.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _EMBEDDED_LEVELS_H_
+#define _EMBEDDED_LEVELS_H_
+
+#include "Constants.h"
+#include "TileClass.h"
+#include <cstddef>
+#include <utility>
+
+/****************************************************************************
+Comments: Builds everything LevelData derives from a level's tiles at
+          compile time: the padded tile grid with the pellets taken out,
+          the direction masks, the pellet count and the bitboard words.  Compiled with PACMAN_EMBED_STOCK_LEVELS, the
+          stock levels in StockLevels.h are made this way and the game
+          starts without reading a single level file.  StockLevels.h is
+          generated from the text levels with "--embed-levels".
+
+          Everything here is single-return constexpr; counts split their
+          range in halves so the recursion stays shallow.
+****************************************************************************/
+const static int EMBEDDED_WORD_BITS = 64;
+
+constexpr bool EmbeddedTileHasClass(const unsigned char *tiles, int width, int height, int xPos, int yPos, unsigned tileClasses) {
+    return xPos >= 0 && xPos < width && yPos >= 0 && yPos < height &&
+           (TILE_CLASS_TABLE.flags[tiles[yPos * width + xPos]] & tileClasses) != 0;
+} // END EmbeddedTileHasClass
+
+constexpr char EmbeddedPaddedTile(const unsigned char *tiles, int width, int height, int paddedIndex) {
+    // Pellets live in the bitboards, the tile underneath is open space
+    return (paddedIndex % (width + 2) == 0 || paddedIndex % (width + 2) == width + 1 ||
+            paddedIndex / (width + 2) == 0 || paddedIndex / (width + 2) == height + 1) ? '\0' :
+           (TILE_CLASS_TABLE.flags[tiles[(paddedIndex / (width + 2) - 1) * width + paddedIndex % (width + 2) - 1]] & TILE_ANY_PELLET) ? ' ' :
+           (char)tiles[(paddedIndex / (width + 2) - 1) * width + paddedIndex % (width + 2) - 1];
+} // END EmbeddedPaddedTile
+
+constexpr unsigned char EmbeddedDirectionMask(const unsigned char *tiles, int width, int height, int xPos, int yPos) {
+    return (unsigned char)((EmbeddedTileHasClass(tiles, width, height, xPos - 1, yPos, TILE_WALKABLE) ? LEFT_BIT : 0) |
+                           (EmbeddedTileHasClass(tiles, width, height, xPos + 1, yPos, TILE_WALKABLE) ? RIGHT_BIT : 0) |
+                           (EmbeddedTileHasClass(tiles, width, height, xPos, yPos + 1, TILE_WALKABLE) ? DOWN_BIT : 0) |
+                           (EmbeddedTileHasClass(tiles, width, height, xPos, yPos - 1, TILE_WALKABLE) ? UP_BIT : 0));
+} // END EmbeddedDirectionMask
+
+constexpr int EmbeddedCountTiles(const unsigned char *tiles, int first, int last, unsigned tileClasses) {
+    return (last - first == 1) ? ((TILE_CLASS_TABLE.flags[tiles[first]] & tileClasses) ? 1 : 0) :
+           (last <= first) ? 0 :
+           EmbeddedCountTiles(tiles, first, first + (last - first) / 2, tileClasses) +
+           EmbeddedCountTiles(tiles, first + (last - first) / 2, last, tileClasses);
+} // END EmbeddedCountTiles
+
+enum EMBEDDED_BOARDS { BOARD_WALKABLE = 0, BOARD_PELLET, BOARD_POWER_PELLET, BOARD_NOT_FIRST_COLUMN, BOARD_NOT_LAST_COLUMN };
+
+constexpr bool EmbeddedBoardBit(const unsigned char *tiles, int width, int height, int board, int index) {
+    return index < width * height &&
+           ((board == BOARD_WALKABLE) ? (TILE_CLASS_TABLE.flags[tiles[index]] & TILE_WALKABLE) != 0 :
+            (board == BOARD_PELLET) ? (TILE_CLASS_TABLE.flags[tiles[index]] & TILE_PELLET) != 0 :
+            (board == BOARD_POWER_PELLET) ? (TILE_CLASS_TABLE.flags[tiles[index]] & TILE_POWER_PELLET) != 0 :
+            (board == BOARD_NOT_FIRST_COLUMN) ? index % width != 0 :
+            index % width != width - 1);
+} // END EmbeddedBoardBit
+
+constexpr unsigned long long EmbeddedBoardWord(const unsigned char *tiles, int width, int height, int board, int word, int bit) {
+    return (bit >= EMBEDDED_WORD_BITS) ? 0ULL :
+           ((EmbeddedBoardBit(tiles, width, height, board, word * EMBEDDED_WORD_BITS + bit) ? 1ULL << bit : 0ULL) |
+            EmbeddedBoardWord(tiles, width, height, board, word, bit + 1));
+} // END EmbeddedBoardWord
+
+/****************************************************************************
+Struct: EmbeddedLevel
+Comments: One level's derived data, laid out exactly as LevelData uses it.
+****************************************************************************/
+template <int Width, int Height>
+struct EmbeddedLevel {
+    const static int PADDED_TILES = (Width + 2) * (Height + 2);
+    const static int TILES = Width * Height;
+    const static int BOARD_WORDS = (TILES + EMBEDDED_WORD_BITS - 1) / EMBEDDED_WORD_BITS;
+
+    int foreColor, backColor, totalDots;
+    char tiles[PADDED_TILES];
+    unsigned char directionMasks[TILES];
+    unsigned long long walkable[BOARD_WORDS], pellet[BOARD_WORDS], powerPellet[BOARD_WORDS];
+    unsigned long long notFirstColumn[BOARD_WORDS], notLastColumn[BOARD_WORDS];
+};
+
+template <int Width, int Height, size_t... Padded, size_t... Tile, size_t... Word>
+constexpr EmbeddedLevel<Width, Height> MakeEmbeddedLevel(const unsigned char *tiles, int foreColor, int backColor,
+                                                         std::index_sequence<Padded...>, std::index_sequence<Tile...>,
+                                                         std::index_sequence<Word...>) {
+    return EmbeddedLevel<Width, Height>{
+        foreColor, backColor, EmbeddedCountTiles(tiles, 0, Width * Height, TILE_ANY_PELLET),
+        { EmbeddedPaddedTile(tiles, Width, Height, (int)Padded)... },
+        { EmbeddedDirectionMask(tiles, Width, Height, (int)Tile % Width, (int)Tile / Width)... },
+        { EmbeddedBoardWord(tiles, Width, Height, BOARD_WALKABLE, (int)Word, 0)... },
+        { EmbeddedBoardWord(tiles, Width, Height, BOARD_PELLET, (int)Word, 0)... },
+        { EmbeddedBoardWord(tiles, Width, Height, BOARD_POWER_PELLET, (int)Word, 0)... },
+        { EmbeddedBoardWord(tiles, Width, Height, BOARD_NOT_FIRST_COLUMN, (int)Word, 0)... },
+        { EmbeddedBoardWord(tiles, Width, Height, BOARD_NOT_LAST_COLUMN, (int)Word, 0)... } };
+} // END MakeEmbeddedLevel
+
+template <int Width, int Height>
+constexpr EmbeddedLevel<Width, Height> MakeEmbeddedLevel(const unsigned char (&tiles)[Width * Height], int foreColor, int backColor) {
+    return MakeEmbeddedLevel<Width, Height>(tiles, foreColor, backColor,
+                                            std::make_index_sequence<EmbeddedLevel<Width, Height>::PADDED_TILES>(),
+                                            std::make_index_sequence<EmbeddedLevel<Width, Height>::TILES>(),
+                                            std::make_index_sequence<EmbeddedLevel<Width, Height>::BOARD_WORDS>());
+} // END MakeEmbeddedLevel
+
+/****************************************************************************
+Struct: EmbeddedLevelView
+Comments: Size independent view of an EmbeddedLevel, what LevelData loads
+          an embedded level from.
+****************************************************************************/
+struct EmbeddedLevelView {
+    int levelNumber, width, height, foreColor, backColor, totalDots;
+    const char *tiles;
+    const unsigned char *directionMasks;
+    const unsigned long long *walkable, *pellet, *powerPellet, *notFirstColumn, *notLastColumn;
+};
+
+template <int Width, int Height>
+constexpr EmbeddedLevelView MakeEmbeddedLevelView(int levelNumber, const EmbeddedLevel<Width, Height> &level) {
+    return EmbeddedLevelView{ levelNumber, Width, Height, level.foreColor, level.backColor, level.totalDots,
+                              level.tiles, level.directionMasks, level.walkable, level.pellet, level.powerPellet,
+                              level.notFirstColumn, level.notLastColumn };
+} // END MakeEmbeddedLevelView
+
+bool WriteStockLevelsHeader(const char *filename, int &levelsWritten);
+#endif // _EMBEDDED_LEVELS_H_
@@ -0,0 +1,85 @@
+/****************************************************************************
+File: FrameOutputBuffer.cpp
+Author: fookenCode
+****************************************************************************/
+#include "FrameOutputBuffer.h"
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+/****************************************************************************
+Function: Grow
+Parameter(s): size_t - Capacity the arena must at least provide.
+Output: N/A
+Comments: Only reached when a frame outgrows the reserved capacity; the
+          arena doubles so it settles after a few frames at most.
+****************************************************************************/
+void FrameOutputBuffer::Grow(size_t minimumCapacity) {
+    size_t newCapacity = (mCapacity > 0) ? mCapacity * 2 : 4096;
+    while (newCapacity < minimumCapacity) {
+        newCapacity *= 2;
+    }
+    char *newBytes = new char[newCapacity];
+    if (mBytes != nullptr) {
+        memcpy(newBytes, mBytes, mLength);
+        delete[] mBytes;
+    }
+    mBytes = newBytes;
+    mCapacity = newCapacity;
+} // END Grow
+
+/****************************************************************************
+Function: AppendNumber
+Parameter(s): unsigned - Value to append in decimal.
+Output: N/A
+Comments: Formats without going through the locale-aware stream machinery.
+****************************************************************************/
+void FrameOutputBuffer::AppendNumber(unsigned value) {
+    char digits[10];
+    int count = 0;
+    do {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+
+    while (count > 0) {
+        Append(digits[--count]);
+    }
+} // END AppendNumber
+
+/****************************************************************************
+Function: Flush
+Parameter(s): N/A
+Output: size_t - Number of bytes written for the frame.
+Comments: Writes the collected frame to stdout with a single call (the
+          loop only repeats on a partial write) and rewinds the arena.
+****************************************************************************/
+size_t FrameOutputBuffer::Flush() {
+    size_t written = 0;
+#ifdef _WIN32
+    HANDLE hOutput = GetStdHandle(STD_OUTPUT_HANDLE);
+    while (written < mLength) {
+        DWORD count = 0;
+        if (!WriteFile(hOutput, mBytes + written, (DWORD)(mLength - written), &count, NULL) || count == 0) {
+            break;
+        }
+        written += count;
+    }
+#else
+    while (written < mLength) {
+        ssize_t count = write(STDOUT_FILENO, mBytes + written, mLength - written);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            break;
+        }
+        written += (size_t)count;
+    }
+#endif
+    mLength = 0;
+    return written;
+} // END Flush
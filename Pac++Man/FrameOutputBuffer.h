@@ -0,0 +1,50 @@
+/****************************************************************************
+File: FrameOutputBuffer.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _FRAME_OUTPUT_BUFFER_H_
+#define _FRAME_OUTPUT_BUFFER_H_
+
+#include <cstring>
+
+/****************************************************************************
+Class: FrameOutputBuffer
+Comments: Preallocated byte arena that collects everything written to the
+          terminal during a frame.  Flush() hands the whole frame to the OS
+          in a single write and rewinds the arena, so steady-state frames
+          neither allocate nor make more than one output call.
+****************************************************************************/
+class FrameOutputBuffer {
+private:
+    char *mBytes;
+    size_t mLength, mCapacity;
+
+    void Grow(size_t minimumCapacity);
+
+    FrameOutputBuffer(const FrameOutputBuffer &other);
+    FrameOutputBuffer &operator=(const FrameOutputBuffer &other);
+public:
+    FrameOutputBuffer() : mBytes(nullptr), mLength(0), mCapacity(0) { }
+    ~FrameOutputBuffer() { delete[] mBytes; }
+
+    void Reserve(size_t capacity) { if (capacity > mCapacity) Grow(capacity); }
+    size_t getLength() { return mLength; }
+    size_t getCapacity() { return mCapacity; }
+    const char *getBytes() { return mBytes; }
+    void Clear() { mLength = 0; }
+
+    inline void Append(char byte) {
+        if (mLength == mCapacity) Grow(mLength + 1);
+        mBytes[mLength++] = byte;
+    }
+    inline void Append(const char *bytes, size_t count) {
+        if (mLength + count > mCapacity) Grow(mLength + count);
+        memcpy(mBytes + mLength, bytes, count);
+        mLength += count;
+    }
+    inline void Append(const char *text) { Append(text, strlen(text)); }
+    void AppendNumber(unsigned value);
+
+    size_t Flush();
+};
+#endif // _FRAME_OUTPUT_BUFFER_H_
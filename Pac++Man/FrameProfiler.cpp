@@ -0,0 +1,252 @@
+/****************************************************************************
+File: FrameProfiler.cpp
+Author: fookenCode
+****************************************************************************/
+#include "FrameProfiler.h"
+#include "Bitboard.h"
+#include "RenderEngine.h"
+#include <cstring>
+
+const static char *FRAME_PHASE_NAMES[MAX_FRAME_PHASES] = { "Update", "Render", "Present", "Frame" };
+
+// Bound by reference in DrawOverlay, so it needs a definition
+const int FrameProfiler::OVERLAY_REFRESH_MILLISECONDS;
+
+/****************************************************************************
+Function: BucketIndex
+Parameter(s): unsigned long long - Value to bucket
+Output: int - Index of the bucket holding the value.
+Comments: Values below SUB_BUCKETS get a bucket each; above that the bucket
+          is the power of two plus the next SUB_BUCKET_BITS bits below it.
+****************************************************************************/
+int LatencyHistogram::BucketIndex(unsigned long long value) {
+    if (value < (unsigned long long)SUB_BUCKETS) {
+        return (int)value;
+    }
+    if (value >= (1ULL << MAX_VALUE_BITS)) {
+        value = (1ULL << MAX_VALUE_BITS) - 1;
+    }
+    const int highestBit = HighestSetBit(value);
+    const int shift = highestBit - SUB_BUCKET_BITS;
+    return (highestBit - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + (int)((value >> shift) & (SUB_BUCKETS - 1));
+} // END BucketIndex
+
+/****************************************************************************
+Function: BucketLowerBound
+Parameter(s): int - Bucket index
+Output: unsigned long long - Smallest value recorded into the bucket.
+Comments: N/A
+****************************************************************************/
+unsigned long long LatencyHistogram::BucketLowerBound(int index) {
+    const int group = index / SUB_BUCKETS, subBucket = index % SUB_BUCKETS;
+    if (group == 0) {
+        return (unsigned long long)subBucket;
+    }
+    return (unsigned long long)(SUB_BUCKETS + subBucket) << (group - 1);
+} // END BucketLowerBound
+
+/****************************************************************************
+Function: BucketUpperBound
+Parameter(s): int - Bucket index
+Output: unsigned long long - Largest value recorded into the bucket.
+Comments: N/A
+****************************************************************************/
+unsigned long long LatencyHistogram::BucketUpperBound(int index) {
+    const int group = index / SUB_BUCKETS;
+    if (group == 0) {
+        return BucketLowerBound(index);
+    }
+    return BucketLowerBound(index) + (1ULL << (group - 1)) - 1;
+} // END BucketUpperBound
+
+/****************************************************************************
+Function: Reset
+Parameter(s): N/A
+Output: N/A
+Comments: N/A
+****************************************************************************/
+void LatencyHistogram::Reset() {
+    memset(mCounts, 0, sizeof(mCounts));
+    mTotalCount = mSum = mMax = 0;
+} // END Reset
+
+/****************************************************************************
+Function: Record
+Parameter(s): unsigned long long - Value to add
+Output: N/A
+Comments: N/A
+****************************************************************************/
+void LatencyHistogram::Record(unsigned long long value) {
+    mCounts[BucketIndex(value)]++;
+    mTotalCount++;
+    mSum += value;
+    if (value > mMax) {
+        mMax = value;
+    }
+} // END Record
+
+/****************************************************************************
+Function: Percentile
+Parameter(s): double - Percentile wanted, 0 to 100
+Output: unsigned long long - Value at or below which that share of the
+                             recorded values fall, 0 if nothing recorded.
+Comments: Reports the top of the bucket the percentile lands in, so the
+          answer errs on the high side, but never past the exact maximum.
+****************************************************************************/
+unsigned long long LatencyHistogram::Percentile(double percent) const {
+    if (mTotalCount == 0) {
+        return 0;
+    }
+    unsigned long long target = (unsigned long long)(percent / 100.0 * mTotalCount + 0.5);
+    if (target < 1) {
+        target = 1;
+    }
+    if (target > mTotalCount) {
+        target = mTotalCount;
+    }
+    unsigned long long seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; ++i) {
+        seen += mCounts[i];
+        if (seen >= target) {
+            // The last bucket also holds everything too large to bucket
+            unsigned long long upperBound = BucketUpperBound(i);
+            return (upperBound < mMax && i < BUCKET_COUNT - 1) ? upperBound : mMax;
+        }
+    }
+    return mMax;
+} // END Percentile
+
+/****************************************************************************
+Function: FrameProfiler
+Parameter(s): N/A
+Output: N/A
+Comments: Constructor
+****************************************************************************/
+FrameProfiler::FrameProfiler() : mOverlayVisible(false), mOverlayCleared(true) {
+    memset(mOverlayLines, 0, sizeof(mOverlayLines));
+} // END FrameProfiler
+
+/****************************************************************************
+Function: Record
+Parameter(s): int - FRAME_PHASES value
+              steady_clock::duration - Time the phase took
+Output: N/A
+Comments: N/A
+****************************************************************************/
+void FrameProfiler::Record(int phase, std::chrono::steady_clock::duration elapsed) {
+    long long nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    mHistograms[phase].Record((nanoseconds > 0) ? (unsigned long long)nanoseconds : 0);
+} // END Record
+
+/****************************************************************************
+Function: ToggleOverlay
+Parameter(s): N/A
+Output: N/A
+Comments: Showing the overlay fills it in straight away.
+****************************************************************************/
+void FrameProfiler::ToggleOverlay() {
+    mOverlayVisible = !mOverlayVisible;
+    if (mOverlayVisible) {
+        RefreshOverlayLines();
+    }
+} // END ToggleOverlay
+
+/****************************************************************************
+Function: RefreshOverlayLines
+Parameter(s): N/A
+Output: N/A
+Comments: Four rows per phase, OVERLAY_WIDTH columns wide, in ms:
+            Update
+            50  0.012
+            99  0.034
+            mx  0.120
+****************************************************************************/
+void FrameProfiler::RefreshOverlayLines() {
+    for (int phase = 0; phase < MAX_FRAME_PHASES; ++phase) {
+        const LatencyHistogram &histogram = mHistograms[phase];
+        char (*lines)[OVERLAY_WIDTH + 8] = mOverlayLines + phase * OVERLAY_ROWS_PER_PHASE;
+        snprintf(lines[0], sizeof(lines[0]), "%-*s", OVERLAY_WIDTH, FRAME_PHASE_NAMES[phase]);
+        snprintf(lines[1], sizeof(lines[1]), "50%7.3f", histogram.Percentile(50.0) / 1e6);
+        snprintf(lines[2], sizeof(lines[2]), "99%7.3f", histogram.Percentile(99.0) / 1e6);
+        snprintf(lines[3], sizeof(lines[3]), "mx%7.3f", histogram.getMax() / 1e6);
+    }
+    mLastOverlayRefresh = std::chrono::steady_clock::now();
+} // END RefreshOverlayLines
+
+/****************************************************************************
+Function: DrawOverlay
+Parameter(s): RenderEngine & - Engine to draw into
+              int - Left column of the overlay
+              int - Top row of the overlay
+Output: N/A
+Comments: Drawn every frame, as a full redraw of the game wipes the back
+          buffer, but the numbers only change every
+          OVERLAY_REFRESH_MILLISECONDS.  Once hidden, the panel is blanked
+          a single time.
+****************************************************************************/
+void FrameProfiler::DrawOverlay(RenderEngine &engine, int xPos, int yPos) {
+    if (!mOverlayVisible) {
+        if (!mOverlayCleared) {
+            char blank[OVERLAY_WIDTH + 1];
+            memset(blank, ' ', OVERLAY_WIDTH);
+            blank[OVERLAY_WIDTH] = '\0';
+            for (int i = 0; i < OVERLAY_ROWS; ++i) {
+                engine.DrawString(xPos, yPos + i, blank, ATTR_DEFAULT);
+            }
+            mOverlayCleared = true;
+        }
+        return;
+    }
+
+    if (std::chrono::steady_clock::now() - mLastOverlayRefresh >= std::chrono::milliseconds(OVERLAY_REFRESH_MILLISECONDS)) {
+        RefreshOverlayLines();
+    }
+    for (int i = 0; i < OVERLAY_ROWS; ++i) {
+        engine.DrawString(xPos, yPos + i, mOverlayLines[i], (i % OVERLAY_ROWS_PER_PHASE == 0) ? ATTR_BOARD_TEXT : ATTR_HIGHLIGHT_TEXT);
+    }
+    mOverlayCleared = false;
+} // END DrawOverlay
+
+/****************************************************************************
+Function: WriteHistogram
+Parameter(s): FILE * - Report being written
+              const char * - Phase name
+              const LatencyHistogram & - Its histogram
+Output: N/A
+Comments: Summary line, then every non-empty bucket with its range.
+****************************************************************************/
+void FrameProfiler::WriteHistogram(FILE *output, const char *name, const LatencyHistogram &histogram) const {
+    fprintf(output, "%s: count %llu mean %.3f p50 %.3f p90 %.3f p99 %.3f p99.9 %.3f max %.3f (ms)\n",
+            name, histogram.getCount(), histogram.getMean() / 1e6,
+            histogram.Percentile(50.0) / 1e6, histogram.Percentile(90.0) / 1e6,
+            histogram.Percentile(99.0) / 1e6, histogram.Percentile(99.9) / 1e6, histogram.getMax() / 1e6);
+
+    unsigned long long seen = 0;
+    for (int i = 0; i < LatencyHistogram::BUCKET_COUNT; ++i) {
+        unsigned long long count = histogram.getBucketCount(i);
+        if (count == 0) {
+            continue;
+        }
+        seen += count;
+        fprintf(output, "  %12llu - %12llu ns %10llu %7.3f%%\n", LatencyHistogram::BucketLowerBound(i),
+                LatencyHistogram::BucketUpperBound(i), count, 100.0 * seen / histogram.getCount());
+    }
+} // END WriteHistogram
+
+/****************************************************************************
+Function: WriteReport
+Parameter(s): const char * - Path of the report to write
+Output: bool - Whether the report was written.
+Comments: Bucket lines give the cumulative percentage in the last column.
+****************************************************************************/
+bool FrameProfiler::WriteReport(const char *filename) const {
+    FILE *output = fopen(filename, "w");
+    if (output == nullptr) {
+        return false;
+    }
+    for (int phase = 0; phase < MAX_FRAME_PHASES; ++phase) {
+        WriteHistogram(output, FRAME_PHASE_NAMES[phase], mHistograms[phase]);
+        fprintf(output, "\n");
+    }
+    return fclose(output) == 0;
+} // END WriteReport
@@ -0,0 +1,84 @@
+/****************************************************************************
+File: FrameProfiler.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _FRAME_PROFILER_H_
+#define _FRAME_PROFILER_H_
+
+#include <chrono>
+#include <cstdio>
+
+class RenderEngine;
+
+/****************************************************************************
+Class: LatencyHistogram
+Comments: Durations in nanoseconds, bucketed logarithmically: every power
+          of two is split into SUB_BUCKETS linear buckets, so any recorded
+          value is known to within 1/SUB_BUCKETS (about 6%) whatever its
+          magnitude.  Recording is a bit scan and an increment into a fixed
+          array; nothing is allocated after construction.
+****************************************************************************/
+class LatencyHistogram {
+public:
+    const static int SUB_BUCKET_BITS = 4;
+    const static int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    // Anything longer (18 minutes) lands in the last bucket
+    const static int MAX_VALUE_BITS = 40;
+    const static int BUCKET_COUNT = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+private:
+    unsigned long long mCounts[BUCKET_COUNT];
+    unsigned long long mTotalCount, mSum, mMax;
+public:
+    LatencyHistogram() { Reset(); }
+
+    static int BucketIndex(unsigned long long value);
+    static unsigned long long BucketLowerBound(int index);
+    static unsigned long long BucketUpperBound(int index);
+
+    void Reset();
+    void Record(unsigned long long value);
+
+    unsigned long long getCount() const { return mTotalCount; }
+    unsigned long long getMax() const { return mMax; }
+    unsigned long long getBucketCount(int index) const { return mCounts[index]; }
+    double getMean() const { return (mTotalCount > 0) ? (double)mSum / mTotalCount : 0.0; }
+    unsigned long long Percentile(double percent) const;
+};
+
+/****************************************************************************
+Class: FrameProfiler
+Comments: One LatencyHistogram per phase of the interactive frame loop,
+          kept for the whole run.  The overlay shows p50, p99 and max of
+          each in milliseconds in the panel beside the map (toggled with
+          'P'); the full histograms are written out on exit.
+****************************************************************************/
+enum FRAME_PHASES { PHASE_UPDATE = 0, PHASE_RENDER, PHASE_PRESENT, PHASE_FRAME, MAX_FRAME_PHASES };
+
+class FrameProfiler {
+private:
+    const static int OVERLAY_WIDTH = 9;
+    const static int OVERLAY_ROWS_PER_PHASE = 4;
+    const static int OVERLAY_ROWS = OVERLAY_ROWS_PER_PHASE * MAX_FRAME_PHASES;
+    // Changing numbers every frame would only make them unreadable
+    const static int OVERLAY_REFRESH_MILLISECONDS = 500;
+
+    LatencyHistogram mHistograms[MAX_FRAME_PHASES];
+    bool mOverlayVisible, mOverlayCleared;
+    std::chrono::steady_clock::time_point mLastOverlayRefresh;
+    char mOverlayLines[OVERLAY_ROWS][OVERLAY_WIDTH + 8];
+
+    void RefreshOverlayLines();
+    void WriteHistogram(FILE *output, const char *name, const LatencyHistogram &histogram) const;
+public:
+    FrameProfiler();
+
+    void Record(int phase, std::chrono::steady_clock::duration elapsed);
+    const LatencyHistogram &getHistogram(int phase) const { return mHistograms[phase]; }
+
+    void ToggleOverlay();
+    bool isOverlayVisible() { return mOverlayVisible; }
+    void DrawOverlay(RenderEngine &engine, int xPos, int yPos);
+
+    bool WriteReport(const char *filename) const;
+};
+#endif // _FRAME_PROFILER_H_
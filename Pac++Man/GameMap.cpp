@@ -3,98 +3,37 @@ File: GameMap.cpp
 Author: fookenCode
 ****************************************************************************/
 #include "GameMap.h"
-#include <iostream>
-#include <fstream>
-#include <Windows.h>
+#include <cstdio>
+#include <cstring>
 #include "Constants.h"
-
-GameMap::GameMap() : mapSizeY(0), mapSizeX(0), totalDots(0), currentLevel(1), 
-                     backColor(0), foreColor(0), mapStrings(nullptr), unalteredMapStrings(nullptr) {
-    renderQueue.clear();
+#include "Bitboard.h"
+#include "RenderEngine.h"
+#include "GridKernels.h"
+#include "TraceRecorder.h"
+#include "TileClass.h"
+
+GameMap::GameMap() : mapSizeY(0), mapSizeX(0), currentLevel(1), mapTiles(nullptr), directionMasks(nullptr), mapStride(0), stockGrid(false), fixedGridEnabled(true),
+                     prefetchedLevelNumber(0), dirtyWordsPerRow(0), dirtyFirstRow(0), dirtyLastRow(-1) {
     loadMap();
-    initializeMapObject();
 }
 
 GameMap::~GameMap() {
-    releaseMapAssetMemory();
 }
 
-/****************************************************************************
-Function: releaseMapAssetMemory
-Parameter(s): N/A
-Output: N/A
-Comments: Frees all memory from Map buffers.
-****************************************************************************/
-void GameMap::releaseMapAssetMemory() {
-    if (mapStrings != nullptr) {
-        for (int i = 0; i < mapSizeY; ++i) {
-            if (mapStrings[i] != nullptr) {
-                delete[] mapStrings[i];
-                mapStrings[i] = nullptr;
-            }
-        }
-        delete[] mapStrings;
-        mapStrings = nullptr;
-    }
-    if (unalteredMapStrings != nullptr) {
-        for (int i = 0; i < mapSizeY; ++i) {
-            if (unalteredMapStrings[i] != nullptr) {
-                delete[] unalteredMapStrings[i];
-                unalteredMapStrings[i] = nullptr;
-            }
-        }
-        delete[] unalteredMapStrings;
-        unalteredMapStrings = nullptr;
-    }
-} // END releaseMapAssetMemory
-
-/****************************************************************************
-Function: allocateMapAssetMemory
-Parameter(s): N/A
-Output: N/A
-Comments: Frees and re-allocates Map buffers to specified dimensions.
-****************************************************************************/
-bool GameMap::allocateMapAssetMemory() {
-    if (mapStrings != nullptr || unalteredMapStrings != nullptr) {
-        releaseMapAssetMemory();
-    }
-
-    mapStrings = new char*[mapSizeY];
-    unalteredMapStrings = new char*[mapSizeY];
-    
-    for (int i = 0; i < mapSizeY; ++i) {
-        mapStrings[i] = new char[mapSizeX+1];
-        unalteredMapStrings[i] = new char[mapSizeX+1];
-
-        if (mapStrings[i] == nullptr || unalteredMapStrings == nullptr) {
-            return false;
-        }
-
-        memset(mapStrings[i], '\0', sizeof(char)*mapSizeX+1);
-        memset(unalteredMapStrings[i], '\0', sizeof(char)*mapSizeX+1);
-    }
-
-    
-    if (mapStrings != nullptr && unalteredMapStrings != nullptr) {
-        return true;
-    }
-
-    return false;
-} // END allocateMapAssetMemory
-
 /****************************************************************************
 Function: initializeMapObject
 Parameter(s): N/A
 Output: N/A
-Comments: Used internally to create the Character Map for game board.
+Comments: Used internally to create the Character Map for game board.  The
+          level itself is shared and never changes, so only the pellets
+          are put back.
 ****************************************************************************/
 void GameMap::initializeMapObject() {
-    for (int i = 0; i < mapSizeY; ++i)
-    {
-        strcpy_s(mapStrings[i], mapSizeX+1, unalteredMapStrings[i]);
+    if (!levelData) {
+        return;
     }
-
-    totalDots = mapLoadedTotalDots;
+    pelletBoard = levelData->getPelletBoard();
+    powerPelletBoard = levelData->getPowerPelletBoard();
 } // END initializeMapObject
 
 /****************************************************************************
@@ -107,48 +46,24 @@ Comments: Used to determine if a move is possible on the Map.
 ****************************************************************************/
 bool GameMap::isWallCharacter(int xPos, int yPos, int wallGroupToTest)
 {
-    char toCompare = mapStrings[yPos][xPos];
-
-    // Wall characters ordered by frequency in the map for optimal tests
-    switch (wallGroupToTest)
-    {
-    case INNER:
-        if (toCompare == '' || toCompare == '' || toCompare == ''  ||
-            toCompare == '' || toCompare == '' || toCompare == '' )
-        {
-            return true;
-        }
-        break;
-    case OUTER:
-        if (toCompare == '' || toCompare == '' || toCompare == '' ||
-            toCompare == '' || toCompare == '' || toCompare == '')
-        {
-            return true;
-        }
-        break;
-    case BOTH:
-        if (toCompare == '' || toCompare == '' || toCompare == '' ||
-            toCompare == '' || toCompare == '' || toCompare == '' ||
-            toCompare == '' || toCompare == '' || toCompare == '' ||
-            toCompare == '' || toCompare == '' || toCompare == '')
-        {
-            return true;
-        }
-        break;
+    static const unsigned char WALL_GROUP_CLASSES[INVALID_GROUP] = { TILE_INNER_WALL, TILE_OUTER_WALL, TILE_ANY_WALL };
 
+    if (wallGroupToTest < INNER || wallGroupToTest >= INVALID_GROUP || !isOnMap(xPos, yPos)) {
+        return false;
     }
-    return false;
+    return TileHasClass(mapTiles[tileIndex(xPos, yPos)], WALL_GROUP_CLASSES[wallGroupToTest]);
 } // END isWallCharacter
 
 /****************************************************************************
-Function: getAvailableDirectionsForPosition
+Function: computeAvailableDirections
 Parameter(s): int - X position to check in Map.
               int - Y position to check in Map.
 Output: Unsigned - Bits representing the available directions.
 Comments: Tests all 4 directions from the given position against the
-MapStrings and returns a bitmask of the valid directions.
+Map and returns a bitmask of the valid directions.  Only needed for
+positions off the Map, the level has the answer for every tile on it.
 ****************************************************************************/
-unsigned GameMap::getAvailableDirectionsForPosition(int xPos, int yPos) {
+unsigned GameMap::computeAvailableDirections(int xPos, int yPos) {
     unsigned returnValue = 0;
     // Left
     if (checkForEmptySpace(xPos - 1, yPos)) {
@@ -168,21 +83,19 @@ unsigned GameMap::getAvailableDirectionsForPosition(int xPos, int yPos) {
     }
 
     return returnValue;
-} // END getAvailableDirectionsForPosition
+} // END computeAvailableDirections
 
 /****************************************************************************
 Function: checkForEmptySpace
 Parameter(s): int - X position to check in Map.
 int - Y position to check in Map.
 Output: Bool - Whether the space is a Dot, PowerDot, or Space.
-Comments: Tests position in the MapStrings for non-wall character.
+Comments: Tests position in the Map for non-wall character.  Pellets sit on
+open space, so the level tiles alone answer this.
 ****************************************************************************/
 bool GameMap::checkForEmptySpace(int xPos, int yPos) {
-    if (xPos >= 0 && xPos <= mapSizeX && yPos >= 0 && yPos < mapSizeY) {
-        char toTest = mapStrings[yPos][xPos];
-        if (toTest == NORML_PELLET_CHARACTER || toTest == ' ' || toTest == POWER_PELLET_CHARACTER) {
-            return true;
-        }
+    if (isOnMap(xPos, yPos)) {
+        return TileHasClass(mapTiles[tileIndex(xPos, yPos)], TILE_WALKABLE);
     }
     return false;
 } // END checkForEmptySpace
@@ -195,173 +108,286 @@ Output: Bool - Whether the space is a Dot, PowerDot, or Space.
 Comments: Tests position in the MapStrings for non-wall character.
 ****************************************************************************/
 bool GameMap::checkForEmptySpace(RenderQueuePosition &posToCheck) {
-    if (posToCheck.xPos >= 0 && posToCheck.xPos <= mapSizeX && posToCheck.yPos >= 0 && posToCheck.yPos < mapSizeY) {
-        char toTest = mapStrings[posToCheck.yPos][posToCheck.xPos];
-        if (toTest == NORML_PELLET_CHARACTER || toTest == ' ' || toTest == POWER_PELLET_CHARACTER) {
+    return checkForEmptySpace(posToCheck.xPos, posToCheck.yPos);
+} // END checkForEmptySpace (overload)
+
+/****************************************************************************
+Function: expandWalkable
+Parameter(s): const Bitboard & - Tiles to grow from
+              Bitboard & - Receives those tiles plus every walkable
+                           neighbour of them (must not be the same board)
+Output: N/A
+Comments: One breadth first search step for all tiles at once: a shift by
+          one column either way and by one row either way.
+****************************************************************************/
+void GameMap::expandWalkable(const Bitboard &from, Bitboard &into) {
+    if (isUsingFixedGrid()) {
+        expandWalkableOnGrid(StockGrid(), from, into);
+    }
+    else {
+        expandWalkableOnGrid(RuntimeGrid(mapSizeX, mapSizeY), from, into);
+    }
+} // END expandWalkable
+
+/****************************************************************************
+Function: expandWalkableOnGrid
+Parameter(s): const Grid & - Dimensions of the current level
+              const Bitboard & - Tiles to expand from
+              Bitboard & - Receives the expanded tiles
+Output: N/A
+Comments: N/A
+****************************************************************************/
+template <class Grid>
+void GameMap::expandWalkableOnGrid(const Grid &grid, const Bitboard &from, Bitboard &into) {
+    if (into.getBitCount() != from.getBitCount()) {
+        into.Resize(from.getBitCount());
+    }
+    ExpandWalkableWords(grid, from.getWords(), levelData->getWalkableBoard().getWords(), levelData->getNotFirstColumnBoard().getWords(),
+                        levelData->getNotLastColumnBoard().getWords(), into.getMutableWords());
+} // END expandWalkableOnGrid
+
+/****************************************************************************
+Function: anyPelletWithinRadius
+Parameter(s): int - X Position within Map
+              int - Y Position within Map
+              int - Tiles to look in every direction
+Output: bool - Whether a pellet or power pellet lies in the square around
+               the position.
+Comments: One masked word test per row of the square.
+****************************************************************************/
+bool GameMap::anyPelletWithinRadius(int xPos, int yPos, int radius) {
+    int firstX = (xPos - radius < 0) ? 0 : xPos - radius;
+    int lastX = (xPos + radius >= mapSizeX) ? mapSizeX - 1 : xPos + radius;
+    int firstY = (yPos - radius < 0) ? 0 : yPos - radius;
+    int lastY = (yPos + radius >= mapSizeY) ? mapSizeY - 1 : yPos + radius;
+
+    for (int i = firstY; i <= lastY && firstX <= lastX; ++i) {
+        if (pelletBoard.AnyInRange(getBoardIndex(firstX, i), getBoardIndex(lastX, i)) ||
+            powerPelletBoard.AnyInRange(getBoardIndex(firstX, i), getBoardIndex(lastX, i))) {
             return true;
         }
     }
     return false;
-} // END checkForEmptySpace (overload)
+} // END anyPelletWithinRadius
 
 /****************************************************************************
-Function: renderMap
-Parameter(s): N/A
+Function: renderTile
+Parameter(s): RenderEngine & - Engine whose back buffer is drawn into.
+              int - X Position within Map
+              int - Y Position within Map
 Output: N/A
-Comments: Loops over entire Map by each character position to render the 
-           Map to the screen.  TODO: Support multiple levels with varying
-           colors.
+Comments: Draws a single Map tile.  Pellets and open space use the default
+          colours, walls and filler use the level colours.
 ****************************************************************************/
-void GameMap::renderMap(bool forceFullRender) {
-    using namespace std;
-    
-    if (forceFullRender) {
-        for (int i = 0; i < mapSizeY; ++i)
-        {
-            for (int j = 0; j < mapSizeX; ++j)
-            {
-                if (j == 0)
-                {
-                    cout << "\033[0m";
-                    for (int spaces = 0; spaces < SCREEN_OFFSET_MARGIN; ++spaces) {
-                        cout << ' ';
-                    }
-                }
+void GameMap::renderTile(RenderEngine &engine, int xPos, int yPos) {
+    char charToPrint = getCharacterAtPosition(xPos, yPos);
+    unsigned char tileClass = GetTileClass(charToPrint);
+    if (tileClass & TILE_WALKABLE)
+    {
+        engine.DrawCharacter(xPos + SCREEN_OFFSET_MARGIN, yPos, charToPrint, ATTR_DEFAULT);
+    }
+    else {
+        if (tileClass & TILE_FILLER) {
+            charToPrint = ' ';
+        }
+        engine.DrawCharacter(xPos + SCREEN_OFFSET_MARGIN, yPos, charToPrint, levelData->getAttribute());
+    }
+} // END renderTile
 
-                if (mapStrings[i][j] == POWER_PELLET_CHARACTER || mapStrings[i][j] == NORML_PELLET_CHARACTER || mapStrings[i][j] == ' ')
-                {
-                    cout << "\033[0m" << mapStrings[i][j];
-                }
-                else {
-                    cout << "\033[" << backColor << ";" << foreColor << ";1m";
-                    if (mapStrings[i][j] == MAP_FILLER_CHARACTER) {
-                        cout << ' ';
-                    }
-                    else {
-                        cout << mapStrings[i][j];
-                    }
-                }
+/****************************************************************************
+Function: renderAllTiles
+Parameter(s): RenderEngine & - Engine to draw into
+              const Grid & - Dimensions of the current level
+Output: N/A
+Comments: Full redraw, one row of cells at a time.  Same glyphs and
+          attributes as renderTile() gives every tile.
+****************************************************************************/
+template <class Grid>
+void GameMap::renderAllTiles(RenderEngine &engine, const Grid &grid) {
+    const unsigned long long *pelletWords = pelletBoard.getWords();
+    const unsigned long long *powerPelletWords = powerPelletBoard.getWords();
+    const unsigned char wallAttribute = levelData->getAttribute();
+    ScreenCell rowCells[MAX_LEVEL_DIMENSION];
+
+    for (int i = 0; i < grid.Height(); ++i) {
+        const char *rowTiles = &mapTiles[(i + 1) * grid.Stride() + 1];
+        for (int j = 0; j < grid.Width(); ++j) {
+            const int boardIndex = i * grid.Width() + j;
+            const unsigned long long bit = 1ULL << (boardIndex % 64);
+            char glyph = rowTiles[j];
+            if (pelletWords[boardIndex / 64] & bit) {
+                glyph = NORML_PELLET_CHARACTER;
             }
-            cout << "\033[0m" << endl;
+            else if (powerPelletWords[boardIndex / 64] & bit) {
+                glyph = POWER_PELLET_CHARACTER;
+            }
+
+            const unsigned char tileClass = GetTileClass(glyph);
+            rowCells[j].glyph = (tileClass & TILE_FILLER) ? ' ' : glyph;
+            rowCells[j].attribute = (tileClass & TILE_WALKABLE) ? (unsigned char)ATTR_DEFAULT : wallAttribute;
+        }
+        engine.DrawCells(SCREEN_OFFSET_MARGIN, i, rowCells, grid.Width());
+    }
+} // END renderAllTiles
+
+/****************************************************************************
+Function: renderMap
+Parameter(s): RenderEngine & - Engine whose back buffer is drawn into.
+              bool - Draw every tile instead of only the queued ones.
+Output: N/A
+Comments: Draws the Map into the back buffer: either the whole Map, or only
+          the tiles queued since the last frame.
+****************************************************************************/
+void GameMap::renderMap(RenderEngine &engine, bool forceFullRender) {
+    TRACE_SCOPE("GameMap::renderMap");
+    if (forceFullRender) {
+        if (isUsingFixedGrid()) {
+            renderAllTiles(engine, StockGrid());
+        }
+        else {
+            renderAllTiles(engine, RuntimeGrid(mapSizeX, mapSizeY));
         }
     }
     else {
-        RenderQueuePosition toRender;
-        COORD Position;
-        char charToPrint;
-        while (!renderQueue.empty()) {
-            // Loop over all of the positions to render to screen
-            toRender = renderQueue.back();
-            Position.X = toRender.xPos + SCREEN_OFFSET_MARGIN;
-            Position.Y = toRender.yPos;
-            charToPrint = mapStrings[toRender.yPos][toRender.xPos];
-            SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), Position);
-            if (charToPrint == ' '
-                || charToPrint == NORML_PELLET_CHARACTER 
-                || charToPrint == POWER_PELLET_CHARACTER )
-            {
-                cout << "\033[0m" << charToPrint;
+        // Visit the dirty tiles in row order, only within each row's span
+        for (int i = dirtyFirstRow; i <= dirtyLastRow; ++i) {
+            DirtySpan &span = dirtySpans[i];
+            if (span.lastX < span.firstX) {
+                continue;
             }
-            else {
-                cout << "\033[" << backColor << ';' << foreColor << ";1m" << charToPrint;
+            unsigned long long *rowBits = &dirtyBits[i * dirtyWordsPerRow];
+            for (int word = span.firstX / DIRTY_WORD_BITS; word <= span.lastX / DIRTY_WORD_BITS; ++word) {
+                unsigned long long bits = rowBits[word];
+                while (bits != 0) {
+                    renderTile(engine, word * DIRTY_WORD_BITS + LowestSetBit(bits), i);
+                    bits &= bits - 1;
+                }
             }
-
-            renderQueue.pop_back();
         }
     }
+    clearRenderQueue();
 } // END renderMap
 
 /****************************************************************************
 Function: loadMap
 Parameter(s): N/A
-Output: N/A
-Comments: Loads the current level from file, allocates buffers, and
-          initializes the UNALTERED buffer for use with game.
+Output: bool - Whether the current level number could be loaded.
+Comments: Switches to the shared data of the current level and puts all of
+          its pellets down.  Each level is only read from disk once per
+          process (See @LevelData.h).
 ****************************************************************************/
 bool GameMap::loadMap() {
-    using namespace std;
-
-    if (currentLevel > 0) {
-        char filename[256];
-        sprintf_s(filename, LEVEL_FILENAME_TEMPLATE, currentLevel);
-        ifstream mapFileInput;
-        mapFileInput.open(filename, fstream::in);
-        if (mapFileInput.is_open()) {
-            int tempX, tempY;
-
-            mapFileInput >> tempX;
-            mapFileInput >> tempY;
-            
-            // Grab colors from file
-            mapFileInput >> foreColor;
-            mapFileInput >> backColor;
-
-            // If the dimensions have not changed, don't do expensive memory allocations
-            if (tempX != mapSizeX || tempY != mapSizeY) {
-                if (mapStrings != nullptr || unalteredMapStrings != nullptr) {
-                    releaseMapAssetMemory();
-                }
-
-                // Update the dimensions of the map
-                mapSizeX = tempX;
-                mapSizeY = tempY;
+    std::shared_ptr<const LevelData> level;
+    if (prefetchedLevel.valid() && prefetchedLevelNumber == currentLevel) {
+        // Usually finished long ago; waits otherwise rather than load twice
+        level = prefetchedLevel.get();
+    }
+    else {
+        level = LevelData::Load(currentLevel);
+    }
+    if (level) {
+        // A different size needs a differently sized render queue
+        if (level->getWidth() != mapSizeX || level->getHeight() != mapSizeY) {
+            dirtyBits.clear();
+            dirtySpans.clear();
+            dirtyFirstRow = 0;
+            dirtyLastRow = -1;
+        }
 
-                allocateMapAssetMemory();
-            }
-            
-            /*
-                [0][0] [0][1] [0][2] ...
-                [1][0] [1][1] [1][2] ...
-            */
-            
-            int count = 0;
-            int unicodeChar;
-            mapLoadedTotalDots = 0;
-            while (!mapFileInput.eof()) {
-                
-                mapFileInput >> hex >>  unicodeChar;
-                unalteredMapStrings[count/mapSizeX][count%mapSizeX] = (char)unicodeChar;
-                
-                // Check for pellet character to increment internal total field tracking this data.
-                if ((char)unicodeChar == POWER_PELLET_CHARACTER || (char)unicodeChar == NORML_PELLET_CHARACTER) {
-                    mapLoadedTotalDots++;
-                }
-                
-                count++;
-                
-                if (count > mapSizeX*mapSizeY) {
-                    break;
-                }
-            }
+        levelData = level;
+        mapSizeX = level->getWidth();
+        mapSizeY = level->getHeight();
+        stockGrid = (mapSizeX == DEFAULT_MAP_WIDTH && mapSizeY == DEFAULT_MAP_HEIGHT);
+        mapStride = level->getStride();
+        mapTiles = level->getTiles();
+        directionMasks = level->getDirectionMasks();
 
-            for (int i = 0; i < mapSizeY; ++i) {
-                unalteredMapStrings[i][mapSizeX] = '\0';
-            }
-            mapFileInput.close();
-
-            initializeMapObject();
-            return true;
-        }
-        else if (mapLoadedTotalDots > 0) {
-            // Re-use the currently loaded map, 
-            // if there is no map for the current level number
-            initializeMapObject();
-        }
+        initializeMapObject();
+        return true;
+    }
+    else if (levelData) {
+        // Re-use the currently loaded map, 
+        // if there is no map for the current level number
+        initializeMapObject();
     }
 
     return false;
 } // END loadMap
 
+/****************************************************************************
+Function: prefetchLevel
+Parameter(s): int - Level number that is about to be played
+Output: N/A
+Comments: Starts loading the level on a background thread, so the file I/O
+          and preprocessing are done by the time loadMap() switches to it.
+          Levels already in memory need no thread.
+****************************************************************************/
+void GameMap::prefetchLevel(int levelNumber) {
+    if (prefetchedLevelNumber == levelNumber) {
+        return;
+    }
+    prefetchedLevelNumber = levelNumber;
+    if (LevelData::IsLoaded(levelNumber)) {
+        prefetchedLevel = std::future<std::shared_ptr<const LevelData> >();
+        return;
+    }
+    prefetchedLevel = std::async(std::launch::async, LevelData::Load, levelNumber);
+} // END prefetchLevel
+
+/****************************************************************************
+Function: allocateRenderQueue
+Parameter(s): N/A
+Output: N/A
+Comments: Sizes the dirty tile bitset and row spans to the Map dimensions.
+          Headless games never queue anything, so never pay for them.
+****************************************************************************/
+void GameMap::allocateRenderQueue() {
+    dirtyWordsPerRow = (mapSizeX + DIRTY_WORD_BITS - 1) / DIRTY_WORD_BITS;
+    dirtyBits.assign((size_t)dirtyWordsPerRow * mapSizeY, 0);
+    dirtySpans.assign(mapSizeY, DirtySpan());
+    dirtyFirstRow = 0;
+    dirtyLastRow = -1;
+} // END allocateRenderQueue
+
 /****************************************************************************
 Function: pushRenderQueuePosition
 Parameter(s): RenderQueuePosition - Entity position data for location to
                                     render.
 Output: N/A
-Comments: Adds the RenderQueuePosition to the Vector to limit the tiles of 
-          the map that need rendering every frame.
+Comments: Marks the tile dirty to limit the tiles of the map that need
+          rendering every frame.  Marking a tile twice is harmless.
 ****************************************************************************/
 void GameMap::pushRenderQueuePosition(RenderQueuePosition newPos) {
-    renderQueue.push_back(newPos);
+    if (newPos.xPos < 0 || newPos.xPos >= mapSizeX || newPos.yPos < 0 || newPos.yPos >= mapSizeY) {
+        return;
+    }
+
+    if (dirtySpans.empty()) {
+        allocateRenderQueue();
+    }
+
+    dirtyBits[newPos.yPos * dirtyWordsPerRow + newPos.xPos / DIRTY_WORD_BITS] |= 1ULL << (newPos.xPos % DIRTY_WORD_BITS);
+
+    DirtySpan &span = dirtySpans[newPos.yPos];
+    if (span.lastX < span.firstX) {
+        span.firstX = span.lastX = newPos.xPos;
+    }
+    else if (newPos.xPos < span.firstX) {
+        span.firstX = newPos.xPos;
+    }
+    else if (newPos.xPos > span.lastX) {
+        span.lastX = newPos.xPos;
+    }
+
+    if (dirtyLastRow < dirtyFirstRow) {
+        dirtyFirstRow = dirtyLastRow = newPos.yPos;
+    }
+    else if (newPos.yPos < dirtyFirstRow) {
+        dirtyFirstRow = newPos.yPos;
+    }
+    else if (newPos.yPos > dirtyLastRow) {
+        dirtyLastRow = newPos.yPos;
+    }
 } // END pushRenderQueuePosition
 
 /****************************************************************************
@@ -369,27 +395,70 @@ Function: clearRenderQueue
 Parameter(s): N/A
 Output: N/A
 Comments: Empties the entire GameMap position queue to avoid re-rendering
-spaces from reset/new level.
+spaces from reset/new level.  Only the rows that were marked are touched.
 ****************************************************************************/
 void GameMap::clearRenderQueue() {
-    renderQueue.clear();
+    if (dirtyLastRow < dirtyFirstRow) {
+        return;
+    }
+    memset(&dirtyBits[dirtyFirstRow * dirtyWordsPerRow], 0,
+           sizeof(unsigned long long) * dirtyWordsPerRow * (dirtyLastRow - dirtyFirstRow + 1));
+    for (int i = dirtyFirstRow; i <= dirtyLastRow; ++i) {
+        dirtySpans[i] = DirtySpan();
+    }
+    dirtyFirstRow = 0;
+    dirtyLastRow = -1;
 } // END clearRenderQueue
 
+/****************************************************************************
+Function: savePellets
+Parameter(s): unsigned long long * - Receives getPelletWordCount() words of
+                                     pellets
+              unsigned long long * - Receives as many of power pellets
+Output: N/A
+Comments: N/A
+****************************************************************************/
+void GameMap::savePellets(unsigned long long *pellets, unsigned long long *powerPellets) {
+    const size_t bytes = (size_t)pelletBoard.getWordCount() * sizeof(unsigned long long);
+    if (bytes > 0) {
+        memcpy(pellets, pelletBoard.getWords(), bytes);
+        memcpy(powerPellets, powerPelletBoard.getWords(), bytes);
+    }
+} // END savePellets
+
+/****************************************************************************
+Function: restorePellets
+Parameter(s): const unsigned long long * - Pellets from savePellets
+              const unsigned long long * - Power pellets from savePellets
+Output: N/A
+Comments: The words must come from a Map of the same size.
+****************************************************************************/
+void GameMap::restorePellets(const unsigned long long *pellets, const unsigned long long *powerPellets) {
+    const size_t bytes = (size_t)pelletBoard.getWordCount() * sizeof(unsigned long long);
+    if (bytes > 0) {
+        memcpy(pelletBoard.getMutableWords(), pellets, bytes);
+        memcpy(powerPelletBoard.getMutableWords(), powerPellets, bytes);
+    }
+} // END restorePellets
+
 /****************************************************************************
 Function: setCharacterAtPosition
 Parameter(s): char - Character to enter at position specified
               int - X Position within Map
               int - Y Position within Map
 Output: N/A
-Comments: Temporarily used to access the Map to edit the current tile for
-          movement and interaction on the map.
+Comments: Only the pellets change during play: entering a pellet character
+          puts one down, anything else removes the pellet at that tile.
+          The level's own tiles are shared and stay as loaded.
 ****************************************************************************/
 void GameMap::setCharacterAtPosition(char toEnter, int xPos, int yPos) {
-    if (xPos < 0 || xPos > mapSizeX || yPos < 0 || yPos > mapSizeY) {
+    if (!isOnMap(xPos, yPos)) {
         return;
     }
 
-    mapStrings[yPos][xPos] = toEnter;
+    unsigned char tileClass = GetTileClass(toEnter);
+    pelletBoard.Assign(getBoardIndex(xPos, yPos), (tileClass & TILE_PELLET) != 0);
+    powerPelletBoard.Assign(getBoardIndex(xPos, yPos), (tileClass & TILE_POWER_PELLET) != 0);
 } // END setCharacterAtPosition
 
 /****************************************************************************
@@ -401,11 +470,18 @@ Comments: Temporarily used to access the Map to retrieve character
           information.
 ****************************************************************************/
 char GameMap::getCharacterAtPosition(int xPos, int yPos) {
-    if (xPos < 0 || xPos > mapSizeX || yPos < 0 || yPos > mapSizeY) {
+    if (!isOnMap(xPos, yPos)) {
         return ' ';
     }
     
-    return mapStrings[yPos][xPos];
+    int boardIndex = getBoardIndex(xPos, yPos);
+    if (pelletBoard.Test(boardIndex)) {
+        return NORML_PELLET_CHARACTER;
+    }
+    if (powerPelletBoard.Test(boardIndex)) {
+        return POWER_PELLET_CHARACTER;
+    }
+    return mapTiles[tileIndex(xPos, yPos)];
 } // END getCharacterAtPosition
 
 /****************************************************************************
@@ -418,7 +494,7 @@ level details.
 const char *GameMap::getCurrentLevelString() {
     memset(levelStatusString, 0, sizeof(char)*MAX_LEVEL_STRING_LENGTH);
     if (currentLevel > 0) {
-        sprintf_s(levelStatusString, LEVEL_TEMPLATE_TEXT, currentLevel);
+        snprintf(levelStatusString, MAX_LEVEL_STRING_LENGTH, LEVEL_TEMPLATE_TEXT, currentLevel);
     }
     return levelStatusString;
 } // END getCurrentLevelString
\ No newline at end of file
@@ -5,8 +5,15 @@ Author: fookenCode
 #ifndef _GAME_MAP_H_
 #define _GAME_MAP_H_
 
+#include "Bitboard.h"
 #include "Constants.h"
+#include "LevelData.h"
+#include <future>
+#include <memory>
 #include <vector>
+
+class RenderEngine;
+
 class GameMap {
 public:
     struct RenderQueuePosition {
@@ -16,20 +23,52 @@ public:
     };
 private:
     const static int MAX_LEVEL_STRING_LENGTH = 16;
-    int mapSizeX, mapSizeY, currentLevel, backColor, foreColor;
-    int totalDots, mapLoadedTotalDots;
-    char **mapStrings, **unalteredMapStrings;
+    int mapSizeX, mapSizeY, currentLevel;
     char levelStatusString[MAX_LEVEL_STRING_LENGTH];
-    std::vector<RenderQueuePosition> renderQueue;
+
+    // The level being played is shared with every other game on it; the
+    // pointers below are cached from it for the hot accessors
+    std::shared_ptr<const LevelData> levelData;
+    const char *mapTiles;
+    const unsigned char *directionMasks;
+    int mapStride;
+    // Stock sized levels run the kernels built for their fixed dimensions
+    bool stockGrid, fixedGridEnabled;
+    inline int tileIndex(int xPos, int yPos) { return (yPos + 1) * mapStride + xPos + 1; }
+    inline bool isOnMap(int xPos, int yPos) { return xPos >= 0 && xPos < mapSizeX && yPos >= 0 && yPos < mapSizeY; }
+
+    // Next level being loaded on a background thread, picked up by loadMap
+    std::future<std::shared_ptr<const LevelData> > prefetchedLevel;
+    int prefetchedLevelNumber;
+
+    // Per game state: the pellets still on the board
+    Bitboard pelletBoard, powerPelletBoard;
+
+    // Tiles waiting to be redrawn: one bit per tile plus the dirty column
+    // range of each row, so marking is O(1) and repeats cost nothing.
+    // Only sized once something is actually queued for rendering.
+    struct DirtySpan {
+        int firstX, lastX;
+        DirtySpan() : firstX(0), lastX(-1) { }
+    };
+    const static int DIRTY_WORD_BITS = 64;
+    std::vector<unsigned long long> dirtyBits;
+    std::vector<DirtySpan> dirtySpans;
+    int dirtyWordsPerRow, dirtyFirstRow, dirtyLastRow;
+    void allocateRenderQueue();
+
+    unsigned computeAvailableDirections(int xPos, int yPos);
+    template <class Grid> void expandWalkableOnGrid(const Grid &grid, const Bitboard &from, Bitboard &into);
+    template <class Grid> void renderAllTiles(RenderEngine &engine, const Grid &grid);
 public:
 
     GameMap();
     virtual ~GameMap();
-    bool allocateMapAssetMemory();
-    void releaseMapAssetMemory();
     void initializeMapObject();
     bool loadMap();
-    void renderMap(bool forceFullRender = false);
+    void prefetchLevel(int levelNumber);
+    void renderTile(RenderEngine &engine, int xPos, int yPos);
+    void renderMap(RenderEngine &engine, bool forceFullRender = false);
     
     int getCurrentLevel() { return currentLevel; }
     const char *getCurrentLevelString();
@@ -39,14 +78,31 @@ public:
     void pushRenderQueuePosition(RenderQueuePosition newPos);
     void clearRenderQueue();
 
-    int getTotalDotsRemaining() { return this->totalDots; }
-    inline void decrementDotsRemaining() { this->totalDots--; }
-    inline void incrementDotsRemaining() { this->totalDots++; }
+    int getTotalDotsRemaining() { return pelletBoard.Count() + powerPelletBoard.Count(); }
+    bool anyPelletWithinRadius(int xPos, int yPos, int radius);
+
+    inline int getBoardIndex(int xPos, int yPos) { return yPos * mapSizeX + xPos; }
+    const Bitboard &getWalkableBoard() { return levelData->getWalkableBoard(); }
+    const Bitboard &getPelletBoard() { return pelletBoard; }
+    const Bitboard &getPowerPelletBoard() { return powerPelletBoard; }
+    void expandWalkable(const Bitboard &from, Bitboard &into);
+    // Snapshots: the pellets are the only per game state of the Map
+    int getPelletWordCount() { return pelletBoard.getWordCount(); }
+    void savePellets(unsigned long long *pellets, unsigned long long *powerPellets);
+    void restorePellets(const unsigned long long *pellets, const unsigned long long *powerPellets);
+    // Only switched off to measure the runtime-sized fallback
+    void setFixedGridEnabled(bool enabled) { fixedGridEnabled = enabled; }
+    bool isUsingFixedGrid() { return stockGrid && fixedGridEnabled; }
     
     bool isWallCharacter(int xPos, int yPos, int wallGroupToTest);
     bool checkForEmptySpace(int xPos, int yPos);
     bool checkForEmptySpace(RenderQueuePosition &posToCheck);
-    unsigned getAvailableDirectionsForPosition(int xPos, int yPos);
+    inline unsigned getAvailableDirectionsForPosition(int xPos, int yPos) {
+        if (isOnMap(xPos, yPos)) {
+            return directionMasks[yPos * mapSizeX + xPos];
+        }
+        return computeAvailableDirections(xPos, yPos);
+    }
 
 
     void setCharacterAtPosition(char toEnter, int xPos, int yPos);
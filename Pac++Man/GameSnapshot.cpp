@@ -0,0 +1,42 @@
+/****************************************************************************
+File: GameSnapshot.cpp
+Author: fookenCode
+****************************************************************************/
+#include "GameSnapshot.h"
+#include <cstdio>
+#include <cstring>
+
+/****************************************************************************
+Function: WriteSnapshotFile
+Parameter(s): const char * - Path of the file to write
+              const GameSnapshot & - Snapshot from PacGame::SaveSnapshot
+Output: bool - Whether the file was written.
+Comments: The bytes of the struct as they are; only readable by a build
+          with the same layout, which the header checks.
+****************************************************************************/
+bool WriteSnapshotFile(const char *filename, const GameSnapshot &snapshot) {
+    FILE *output = fopen(filename, "wb");
+    if (output == nullptr) {
+        return false;
+    }
+    bool written = fwrite(&snapshot, sizeof(snapshot), 1, output) == 1;
+    return (fclose(output) == 0) && written;
+} // END WriteSnapshotFile
+
+/****************************************************************************
+Function: ReadSnapshotFile
+Parameter(s): const char * - Path of the file to read
+              GameSnapshot & - Receives the snapshot
+Output: bool - Whether a snapshot of this build's layout was read.
+Comments: N/A
+****************************************************************************/
+bool ReadSnapshotFile(const char *filename, GameSnapshot &snapshot) {
+    FILE *input = fopen(filename, "rb");
+    if (input == nullptr) {
+        return false;
+    }
+    bool read = fread(&snapshot, sizeof(snapshot), 1, input) == 1;
+    fclose(input);
+    return read && memcmp(snapshot.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) == 0 &&
+           snapshot.version == SNAPSHOT_FORMAT_VERSION && snapshot.size == sizeof(GameSnapshot);
+} // END ReadSnapshotFile
@@ -0,0 +1,66 @@
+/****************************************************************************
+File: GameSnapshot.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _GAME_SNAPSHOT_H_
+#define _GAME_SNAPSHOT_H_
+
+#include "Constants.h"
+#include <type_traits>
+
+/****************************************************************************
+Struct: EntitySnapshot / GhostSnapshot / GameSnapshot
+Comments: Everything a PacGame needs to carry on from a given tick, in one
+          fixed-layout, trivially copyable block of about 1.3 KB: no
+          pointers, so a snapshot is copied with a plain assignment or
+          memcpy and written to disk as is.  The level's own tiles are not
+          in it, only its number and the pellets still on it.  Presentation
+          state (what is on screen) is not kept either; restoring redraws
+          everything.
+          See PacGame::SaveSnapshot / PacGame::RestoreSnapshot.
+****************************************************************************/
+const static char SNAPSHOT_MAGIC[4] = { 'P', 'A', 'C', 'S' };
+const static unsigned SNAPSHOT_FORMAT_VERSION = 1;
+// Largest level (in tiles) a snapshot has room for the pellets of
+const static int SNAPSHOT_MAX_TILES = 64 * 64;
+const static int SNAPSHOT_BOARD_WORDS = SNAPSHOT_MAX_TILES / 64;
+
+// Status text shown under the Ghost box, by meaning rather than pointer
+enum SNAPSHOT_STATUS_TEXTS { STATUS_CLEAR = 0, STATUS_PRESS_START, STATUS_READY, STATUS_PAUSED, STATUS_GAMEOVER, STATUS_LEVEL };
+
+struct EntitySnapshot {
+    double xPos, yPos, movementSpeed;
+    int movementDirection;
+};
+
+struct GhostSnapshot {
+    EntitySnapshot entity;
+    double timeToSwitchDir;
+    int vulnerableStatus, respawnTimer;
+    unsigned randomState[4];
+    unsigned char active, hasTarget;
+};
+
+struct GameSnapshot {
+    char magic[4];
+    unsigned version, size;
+
+    int level, mapWidth, mapHeight;
+    int gameState, lastAISpawnTime, vulnerabilityTimer, restartDelayTimer, ghostMultiplier;
+    unsigned gameTicks;
+    int gameTime;
+    unsigned lastInputBits, randomSeed;
+    long long score;
+    int livesLeft, credits, statusText;
+    unsigned char creditInserted;
+
+    EntitySnapshot player;
+    GhostSnapshot ghosts[MAX_ENEMIES];
+    unsigned long long pellets[SNAPSHOT_BOARD_WORDS], powerPellets[SNAPSHOT_BOARD_WORDS];
+};
+static_assert(std::is_trivially_copyable<GameSnapshot>::value && std::is_standard_layout<GameSnapshot>::value,
+              "GameSnapshot must stay a plain block of bytes");
+
+bool WriteSnapshotFile(const char *filename, const GameSnapshot &snapshot);
+bool ReadSnapshotFile(const char *filename, GameSnapshot &snapshot);
+#endif // _GAME_SNAPSHOT_H_
@@ -3,18 +3,16 @@ File: GhostEntity.cpp
 Author: fookenCode
 ****************************************************************************/
 #include "GhostEntity.h"
-#include <Windows.h>
-#include <iostream>
+#include "Metrics.h"
+#include "RenderEngine.h"
+#include <cfloat>
 #include <cmath>
-#include <cstdlib>
-#include <time.h>
 
 GhostEntity::GhostEntity() {
     mGhostIcon = (char)0x94;
     timeToSwitchDir = 0.0;
     mTarget = nullptr;
     setMovementSpeed(MOVING_ENTITY_DEFAULT_SPEED);
-    srand(time(NULL));
 }
 
 /****************************************************************************
@@ -31,26 +29,16 @@ void GhostEntity::Reset() {
     setMovementDirection(MAX_DIRECTION);
     timeToSwitchDir = 0.0;
     mActive = false;
-    setInvalidated(true);
 } // END Reset
 
 /****************************************************************************
 Function: Render
-Parameter(s): N/A
+Parameter(s): RenderEngine & - Engine whose back buffer is drawn into.
 Output: N/A
 Comments: Draws the Ghost entity to the screen at its current X/Y Position.
 ****************************************************************************/
-void GhostEntity::Render() {
-    if (isInvalidated) {
-        COORD Position;
-        Position.X = (int)getXPosition() + SCREEN_OFFSET_MARGIN;
-        Position.Y = (int)getYPosition();
-        SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), Position);
-        SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), getGhostColor());
-        std::cout << getGhostIcon();
-        SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), 7);
-        setInvalidated(false);
-    }
+void GhostEntity::Render(RenderEngine &engine) {
+    engine.DrawCharacter((int)getXPosition() + SCREEN_OFFSET_MARGIN, (int)getYPosition(), getGhostIcon(), (unsigned char)getGhostColor());
 } // END Render
 
 /****************************************************************************
@@ -65,9 +53,41 @@ void GhostEntity::initializeGhost() {
     setXPos(AI_BOX_ACTIVE_X_POSITION);
     setYPos(AI_BOX_ACTIVE_Y_POSITION);
     setMovementDirection(LEFT);
-    setInvalidated(true);
 } // END initializeGhost
 
+/****************************************************************************
+Function: SaveState
+Parameter(s): GhostSnapshot & - Receives the Ghost's state
+Output: N/A
+Comments: N/A
+****************************************************************************/
+void GhostEntity::SaveState(GhostSnapshot &snapshot) {
+    SaveMovement(snapshot.entity);
+    snapshot.timeToSwitchDir = timeToSwitchDir;
+    snapshot.vulnerableStatus = mVulnerableStatus;
+    snapshot.respawnTimer = mRespawnTimer;
+    mRandom.getState(snapshot.randomState);
+    snapshot.active = mActive ? 1 : 0;
+    snapshot.hasTarget = (mTarget != nullptr) ? 1 : 0;
+} // END SaveState
+
+/****************************************************************************
+Function: RestoreState
+Parameter(s): const GhostSnapshot & - State from SaveState
+              Entity * - What the Ghost chases, if the snapshot had a target
+Output: N/A
+Comments: N/A
+****************************************************************************/
+void GhostEntity::RestoreState(const GhostSnapshot &snapshot, Entity *target) {
+    RestoreMovement(snapshot.entity);
+    timeToSwitchDir = snapshot.timeToSwitchDir;
+    mVulnerableStatus = snapshot.vulnerableStatus;
+    mRespawnTimer = snapshot.respawnTimer;
+    mRandom.setState(snapshot.randomState);
+    mActive = snapshot.active != 0;
+    mTarget = snapshot.hasTarget ? target : nullptr;
+} // END RestoreState
+
 /****************************************************************************
 Function: Update
 Parameter(s): unsigned - Byte that contains all eligible directions to move.
@@ -83,6 +103,7 @@ void GhostEntity::Update(unsigned validDirections, double timeStep) {
     timeToSwitchDir -= (int)timeStep;
     
     if (timeToSwitchDir <= 0 && mTarget != nullptr) {
+        Metrics::Increment(COUNTER_GHOST_DECISIONS);
         switch (getMovementDirection()) {
         case LEFT:
         case RIGHT:
@@ -147,7 +168,6 @@ void GhostEntity::Move(double timeStep) {
     double xPos = getXPosition();
     double yPos = getYPosition();
     double nextPos = 0.0;
-    setInvalidated(true);
 
     switch (movementDirection)
     {
@@ -6,6 +6,7 @@ Author: fookenCode
 #define _GHOST_ENTITY_H_
 
 #include "MovingEntity.h"
+#include "Random.h"
 
 class GhostEntity : public MovingEntity {
 private:
@@ -16,6 +17,8 @@ private:
     bool mActive;
 
     Entity *mTarget;
+    // This ghost's own stream of the game's random numbers
+    Random mRandom;
 public:
     GhostEntity();
     virtual ~GhostEntity() { }
@@ -32,16 +35,21 @@ public:
     void setGhostIcon(char icon) { this->mGhostIcon = icon; }
     char getGhostIcon() { return this->mGhostIcon; }
 
-    void setVulnerable(bool status) { (status) ? mVulnerableStatus = VULNERABLE : mVulnerableStatus = INVULNERABLE; setInvalidated(true); }
+    void setVulnerable(bool status) { (status) ? mVulnerableStatus = VULNERABLE : mVulnerableStatus = INVULNERABLE; }
     bool isVulnerable() { return (mVulnerableStatus == VULNERABLE); }
 
     void setRespawnTimer(int timer) { this->mRespawnTimer = timer; }
     int getRespawnTimer() { return this->mRespawnTimer; }
 
+    void setRandomStream(unsigned long long seed, unsigned stream) { mRandom.Seed(seed, stream); }
+
+    void SaveState(GhostSnapshot &snapshot);
+    void RestoreState(const GhostSnapshot &snapshot, Entity *target);
+
     void initializeGhost();
     virtual void Update(unsigned validDirections, double timeStep);
     virtual void Move(double timeStep);
-    virtual void Render();
+    virtual void Render(RenderEngine &engine);
     virtual void Reset();
 };
 #endif // _GHOST_ENTITY_H_
\ No newline at end of file
@@ -0,0 +1,104 @@
+/****************************************************************************
+File: GridKernels.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _GRID_KERNELS_H_
+#define _GRID_KERNELS_H_
+
+#include "Constants.h"
+
+/****************************************************************************
+Struct: FixedGrid
+Comments: Map dimensions known at compile time.  Kernels instantiated with
+          it see every width, stride, word count and shift as a constant,
+          so index math folds away and the row loops can be unrolled.
+****************************************************************************/
+template <int GridWidth, int GridHeight>
+struct FixedGrid {
+    const static int WORD_BITS = 64;
+
+    constexpr int Width() const { return GridWidth; }
+    constexpr int Height() const { return GridHeight; }
+    constexpr int Stride() const { return GridWidth + 2; }
+    constexpr int WordCount() const { return (GridWidth * GridHeight + WORD_BITS - 1) / WORD_BITS; }
+};
+
+// Dimensions of the stock levels
+typedef FixedGrid<DEFAULT_MAP_WIDTH, DEFAULT_MAP_HEIGHT> StockGrid;
+
+/****************************************************************************
+Struct: RuntimeGrid
+Comments: Fallback for levels of any other size.
+****************************************************************************/
+struct RuntimeGrid {
+    const static int WORD_BITS = 64;
+    int width, height;
+
+    RuntimeGrid(int width, int height) : width(width), height(height) { }
+    int Width() const { return width; }
+    int Height() const { return height; }
+    int Stride() const { return width + 2; }
+    int WordCount() const { return (width * height + WORD_BITS - 1) / WORD_BITS; }
+};
+
+/****************************************************************************
+Function: ShiftedWord
+Parameter(s): const unsigned long long * - Board words
+              int - Word count
+              int - Index of the word wanted
+              int - Bits to shift by; positive moves towards higher indices
+Output: unsigned long long - Word i of the board shifted by the given bits.
+Comments: Same result as one word of Bitboard::ShiftInto.
+****************************************************************************/
+inline unsigned long long ShiftedWord(const unsigned long long *words, int wordCount, int i, int shift) {
+    const int distance = (shift < 0) ? -shift : shift;
+    const int wordShift = distance / 64, bitShift = distance % 64;
+    if (shift >= 0) {
+        const int source = i - wordShift;
+        if (source < 0) {
+            return 0;
+        }
+        unsigned long long word = words[source] << bitShift;
+        if (bitShift != 0 && source > 0) {
+            word |= words[source - 1] >> (64 - bitShift);
+        }
+        return word;
+    }
+    const int source = i + wordShift;
+    if (source >= wordCount) {
+        return 0;
+    }
+    unsigned long long word = words[source] >> bitShift;
+    if (bitShift != 0 && source + 1 < wordCount) {
+        word |= words[source + 1] << (64 - bitShift);
+    }
+    return word;
+} // END ShiftedWord
+
+/****************************************************************************
+Function: ExpandWalkableWords
+Parameter(s): const Grid & - Map dimensions
+              const unsigned long long * - Tiles to expand from
+              const unsigned long long * - Walkable tiles of the level
+              const unsigned long long * - Every tile but the first column
+              const unsigned long long * - Every tile but the last column
+              unsigned long long * - Receives the expanded tiles
+Output: N/A
+Comments: One pass over the words computing (from | its four neighbour
+          shifts) & walkable, the kernel behind GameMap::expandWalkable.
+****************************************************************************/
+template <class Grid>
+inline void ExpandWalkableWords(const Grid &grid, const unsigned long long *from, const unsigned long long *walkable,
+                                const unsigned long long *notFirstColumn, const unsigned long long *notLastColumn,
+                                unsigned long long *into) {
+    const int wordCount = grid.WordCount();
+    for (int i = 0; i < wordCount; ++i) {
+        unsigned long long expanded = from[i];
+        expanded |= ShiftedWord(from, wordCount, i, 1) & notFirstColumn[i];
+        expanded |= ShiftedWord(from, wordCount, i, -1) & notLastColumn[i];
+        expanded |= ShiftedWord(from, wordCount, i, grid.Width());
+        expanded |= ShiftedWord(from, wordCount, i, -grid.Width());
+        into[i] = expanded & walkable[i];
+    }
+} // END ExpandWalkableWords
+#endif // _GRID_KERNELS_H_
@@ -0,0 +1,98 @@
+/****************************************************************************
+File: InputPolicies.cpp
+Author: fookenCode
+****************************************************************************/
+#include "InputPolicies.h"
+#include "PacGame.h"
+#include "TileClass.h"
+#include <utility>
+
+// A private generator, so that policies never touch global state
+RandomWalkInput::RandomWalkInput(unsigned seed) : mRandom(seed), mHeldDirection(LEFT), mTicksUntilTurn(0) {
+}
+
+/****************************************************************************
+Function: PollInput
+Parameter(s): unsigned - Simulation tick the input is sampled for.
+Output: unsigned - GAME_INPUTS bits pressed for this tick.
+Comments: Holds a random direction for 8 to 39 ticks before turning.
+****************************************************************************/
+unsigned RandomWalkInput::PollInput(unsigned /*tick*/) {
+    if (mTicksUntilTurn == 0) {
+        mHeldDirection = mRandom.NextBelow(MAX_DIRECTION);
+        mTicksUntilTurn = 8 + mRandom.NextBelow(32);
+    }
+    mTicksUntilTurn--;
+
+    return INPUT_START_BIT | (LEFT_BIT << mHeldDirection);
+} // END PollInput
+
+GreedyPelletInput::GreedyPelletInput(PacGame *game) : mGame(game), mLastXPos(-1), mLastYPos(-1), mHeldDirectionBit(0) {
+}
+
+/****************************************************************************
+Function: FindDirectionToNearestPellet
+Parameter(s): int - X Position of the Player within Map
+              int - Y Position of the Player within Map
+Output: unsigned - DIRECTION_BITS value for the first step of the path, or
+                   zero when no pellet can be reached.
+Comments: Breadth first search run backwards on the Map bitboards: the
+          set of pellets grows by one walkable step at a time until it
+          reaches a tile next to the Player, which is then the first step
+          of a shortest path.  The boards are kept between calls so no
+          allocation happens once the first search has sized them.
+****************************************************************************/
+unsigned GreedyPelletInput::FindDirectionToNearestPellet(int xPos, int yPos) {
+    GameMap &map = mGame->mGameMap;
+    const int width = map.getMapWidth();
+    const int height = map.getMapHeight();
+    const int xOffsets[MAX_DIRECTION] = { -1, 0, 1, 0 };
+    const int yOffsets[MAX_DIRECTION] = { 0, -1, 0, 1 };
+
+    if (xPos < 0 || xPos >= width || yPos < 0 || yPos >= height) {
+        return 0;
+    }
+    unsigned validDirections = map.getAvailableDirectionsForPosition(xPos, yPos);
+    if (validDirections == 0) {
+        return 0;
+    }
+
+    mReached = map.getPelletBoard();
+    mReached |= map.getPowerPelletBoard();
+    mExpanded.Resize(mReached.getBitCount());
+
+    for (;;) {
+        for (int direction = 0; direction < MAX_DIRECTION; ++direction) {
+            if ((validDirections & (LEFT_BIT << direction)) &&
+                mReached.Test(map.getBoardIndex(xPos + xOffsets[direction], yPos + yOffsets[direction]))) {
+                return LEFT_BIT << direction;
+            }
+        }
+
+        map.expandWalkable(mReached, mExpanded);
+        if (mExpanded == mReached) {
+            return 0;
+        }
+        std::swap(mReached, mExpanded);
+    }
+} // END FindDirectionToNearestPellet
+
+/****************************************************************************
+Function: PollInput
+Parameter(s): unsigned - Simulation tick the input is sampled for.
+Output: unsigned - GAME_INPUTS bits pressed for this tick.
+Comments: Holds Start so finished games restart, and the direction of the
+          shortest path to a pellet.
+****************************************************************************/
+unsigned GreedyPelletInput::PollInput(unsigned /*tick*/) {
+    int xPos = (int)mGame->mPlayer.getXPosition();
+    int yPos = (int)mGame->mPlayer.getYPosition();
+
+    if (xPos != mLastXPos || yPos != mLastYPos || mHeldDirectionBit == 0) {
+        mHeldDirectionBit = FindDirectionToNearestPellet(xPos, yPos);
+        mLastXPos = xPos;
+        mLastYPos = yPos;
+    }
+
+    return INPUT_START_BIT | mHeldDirectionBit;
+} // END PollInput
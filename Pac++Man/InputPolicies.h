@@ -0,0 +1,48 @@
+/****************************************************************************
+File: InputPolicies.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _INPUT_POLICIES_H_
+#define _INPUT_POLICIES_H_
+
+#include "Bitboard.h"
+#include "InputSource.h"
+#include "Random.h"
+
+class PacGame;
+
+enum INPUT_POLICIES { POLICY_RANDOM_WALK = 0, POLICY_GREEDY_PELLET, MAX_POLICY };
+
+/****************************************************************************
+Class: RandomWalkInput
+Comments: Scripted player used for headless runs.  Keeps the Start button
+          held so a finished game restarts straight away and picks a new
+          random direction every few ticks.  Fully determined by the seed.
+****************************************************************************/
+class RandomWalkInput : public InputSource {
+private:
+    Random mRandom;
+    unsigned mHeldDirection, mTicksUntilTurn;
+public:
+    RandomWalkInput(unsigned seed = 1);
+    virtual unsigned PollInput(unsigned tick);
+};
+
+/****************************************************************************
+Class: GreedyPelletInput
+Comments: Scripted player that steers along the shortest path to the
+          nearest pellet.  Ghosts are ignored.  The path is only searched
+          again once the Player reaches a new tile.
+****************************************************************************/
+class GreedyPelletInput : public InputSource {
+private:
+    PacGame *mGame;
+    int mLastXPos, mLastYPos;
+    unsigned mHeldDirectionBit;
+    Bitboard mReached, mExpanded;
+    unsigned FindDirectionToNearestPellet(int xPos, int yPos);
+public:
+    GreedyPelletInput(PacGame *game);
+    virtual unsigned PollInput(unsigned tick);
+};
+#endif // _INPUT_POLICIES_H_
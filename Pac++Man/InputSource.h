@@ -0,0 +1,33 @@
+/****************************************************************************
+File: InputSource.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _INPUT_SOURCE_H_
+#define _INPUT_SOURCE_H_
+
+#include "Constants.h"
+
+/****************************************************************************
+Class: InputSource
+Comments: Supplies the PacGame with the state of every game input
+          (See @Constants.h GAME_INPUTS) once per simulation tick.  The game
+          never queries a device directly, so the same simulation can be
+          driven from the keyboard, a scripted policy, or a replay.
+****************************************************************************/
+class InputSource {
+public:
+    InputSource() { }
+    virtual ~InputSource() { }
+
+    virtual unsigned PollInput(unsigned tick) = 0;
+};
+
+/****************************************************************************
+Class: NullInputSource
+Comments: Input source that never presses anything.
+****************************************************************************/
+class NullInputSource : public InputSource {
+public:
+    virtual unsigned PollInput(unsigned /*tick*/) { return 0; }
+};
+#endif // _INPUT_SOURCE_H_
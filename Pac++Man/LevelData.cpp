@@ -0,0 +1,334 @@
+/****************************************************************************
+File: LevelData.cpp
+Author: fookenCode
+****************************************************************************/
+#include "LevelData.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <map>
+#include <mutex>
+#include "EmbeddedLevels.h"
+#include "LevelTextParser.h"
+#include "Metrics.h"
+#include "RenderEngine.h"
+#include "TileClass.h"
+#include "TraceRecorder.h"
+#ifdef PACMAN_EMBED_STOCK_LEVELS
+#include "StockLevels.h"
+#endif
+
+const char LevelData::SENTINEL_TILE;
+
+/****************************************************************************
+Struct: LevelCache
+Comments: Every level loaded (or being loaded) so far and the level pack
+          they came from, shared by all games of the process.  The lock
+          only guards the map; levels are read outside of it and handed
+          to everyone waiting through their future.
+****************************************************************************/
+struct LevelCache {
+    typedef std::shared_future<std::shared_ptr<const LevelData> > LevelFuture;
+    std::mutex lock;
+    std::map<int, LevelFuture> levels;
+    std::once_flag packOpened;
+    std::shared_ptr<const LevelPack> pack;
+    std::atomic<bool> stalePackReported;
+    LevelCache() : stalePackReported(false) { }
+};
+
+static LevelCache &GetLevelCache() {
+    static LevelCache cache;
+    return cache;
+}
+
+LevelData::LevelData() : mWidth(0), mHeight(0), mStride(0), mTotalDots(0), mForeColor(0), mBackColor(0), mAttribute(ATTR_DEFAULT),
+                         mTiles(nullptr), mDirectionMasks(nullptr) {
+}
+
+/****************************************************************************
+Function: Load
+Parameter(s): int - Level number
+Output: std::shared_ptr<const LevelData> - The level, or empty when there
+                                           is no such level.
+Comments: Levels are taken from the level pack (or read from their text
+          file when the pack does not have them, or the text file has
+          changed since the pack was compiled) the first time they are
+          asked for and cached for the life of the process.  Safe to call
+          from several threads at once: the first caller of a level reads
+          it without holding the cache lock, later callers of the same
+          level wait for that read instead of repeating it.
+****************************************************************************/
+std::shared_ptr<const LevelData> LevelData::Load(int levelNumber) {
+    TRACE_SCOPE("LevelData::Load");
+    LevelCache &cache = GetLevelCache();
+    std::promise<std::shared_ptr<const LevelData> > loaded;
+    LevelCache::LevelFuture cached;
+    {
+        std::lock_guard<std::mutex> lock(cache.lock);
+        std::map<int, LevelCache::LevelFuture>::iterator found = cache.levels.find(levelNumber);
+        if (found != cache.levels.end()) {
+            cached = found->second;
+        }
+        else {
+            // Missing levels are remembered too, so they are not retried every time
+            cache.levels[levelNumber] = loaded.get_future().share();
+        }
+    }
+    if (cached.valid()) {
+        return cached.get();
+    }
+    Metrics::Increment(COUNTER_LEVEL_LOADS);
+
+#ifdef PACMAN_EMBED_STOCK_LEVELS
+    for (size_t i = 0; i < sizeof(STOCK_LEVELS) / sizeof(STOCK_LEVELS[0]); ++i) {
+        if (STOCK_LEVELS[i].levelNumber == levelNumber) {
+            std::shared_ptr<LevelData> embeddedLevel(new LevelData());
+            embeddedLevel->LoadFromEmbedded(STOCK_LEVELS[i]);
+            loaded.set_value(embeddedLevel);
+            return embeddedLevel;
+        }
+    }
+#endif
+
+    std::call_once(cache.packOpened, [&cache]() { cache.pack = LevelPack::Open(LEVEL_PACK_FILENAME); });
+
+    std::shared_ptr<const LevelData> level;
+    const LevelPack::LevelRecord *record = cache.pack ? cache.pack->FindLevel(levelNumber) : nullptr;
+    if (record != nullptr) {
+        // A pack shipped without the text levels is used as it is
+        char filename[256];
+        uint64_t sourceSize;
+        int64_t sourceModified;
+        snprintf(filename, sizeof(filename), LEVEL_FILENAME_TEMPLATE, levelNumber);
+        if (LevelPack::ReadSourceStamp(filename, sourceSize, sourceModified) &&
+            (sourceSize != record->sourceSize || sourceModified != record->sourceModified)) {
+            if (!cache.stalePackReported.exchange(true)) {
+                fprintf(stderr, "%s is older than %s, using the text levels; run --compile-levels to update it\n",
+                        LEVEL_PACK_FILENAME, filename);
+            }
+            record = nullptr;
+        }
+    }
+    if (record != nullptr) {
+        std::shared_ptr<LevelData> packedLevel(new LevelData());
+        packedLevel->LoadFromPack(cache.pack, *record);
+        level = packedLevel;
+    }
+    else {
+        level = LoadText(levelNumber);
+    }
+    loaded.set_value(level);
+    return level;
+} // END Load
+
+/****************************************************************************
+Function: IsLoaded
+Parameter(s): int - Level number
+Output: bool - Whether Load() would return without touching any file.
+Comments: A level still being read by another thread is not loaded yet.
+****************************************************************************/
+bool LevelData::IsLoaded(int levelNumber) {
+    LevelCache &cache = GetLevelCache();
+    std::lock_guard<std::mutex> lock(cache.lock);
+    std::map<int, LevelCache::LevelFuture>::iterator cached = cache.levels.find(levelNumber);
+    return cached != cache.levels.end() && cached->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+} // END IsLoaded
+
+/****************************************************************************
+Function: LoadText
+Parameter(s): int - Level number
+Output: std::shared_ptr<const LevelData> - The level, or empty when there
+                                           is no text file for it.
+Comments: Always parses the text level, bypassing the cache and the pack.
+          Used by the level pack compiler.
+****************************************************************************/
+std::shared_ptr<const LevelData> LevelData::LoadText(int levelNumber) {
+    if (levelNumber <= 0) {
+        return std::shared_ptr<const LevelData>();
+    }
+    char filename[256];
+    snprintf(filename, sizeof(filename), LEVEL_FILENAME_TEMPLATE, levelNumber);
+    std::shared_ptr<LevelData> loadedLevel(new LevelData());
+    if (!loadedLevel->LoadFromFile(filename)) {
+        return std::shared_ptr<const LevelData>();
+    }
+    return loadedLevel;
+} // END LoadText
+
+/****************************************************************************
+Function: LoadFromPack
+Parameter(s): const std::shared_ptr<const LevelPack> & - Pack holding it
+              const LevelPack::LevelRecord & - The level's validated record
+Output: N/A
+Comments: Nothing is parsed: the tiles and direction masks are used in
+          place and the few bitboard words are copied.
+****************************************************************************/
+void LevelData::LoadFromPack(const std::shared_ptr<const LevelPack> &pack, const LevelPack::LevelRecord &record) {
+    const char *bytes = (const char *)&record;
+    mPack = pack;
+    mWidth = (int)record.width;
+    mHeight = (int)record.height;
+    mStride = mWidth + 2;
+    mForeColor = (int)record.foreColor;
+    mBackColor = (int)record.backColor;
+    mAttribute = (unsigned char)record.attribute;
+    mTotalDots = (int)record.totalDots;
+
+    mTiles = bytes + record.tilesOffset;
+    mDirectionMasks = (const unsigned char *)(bytes + record.directionMasksOffset);
+
+    const int tileCount = mWidth * mHeight;
+    mWalkableBoard.AssignWords((const unsigned long long *)(bytes + record.walkableOffset), tileCount);
+    mPelletBoard.AssignWords((const unsigned long long *)(bytes + record.pelletOffset), tileCount);
+    mPowerPelletBoard.AssignWords((const unsigned long long *)(bytes + record.powerPelletOffset), tileCount);
+    mNotFirstColumnBoard.AssignWords((const unsigned long long *)(bytes + record.notFirstColumnOffset), tileCount);
+    mNotLastColumnBoard.AssignWords((const unsigned long long *)(bytes + record.notLastColumnOffset), tileCount);
+} // END LoadFromPack
+
+/****************************************************************************
+Function: LoadFromEmbedded
+Parameter(s): const EmbeddedLevelView & - Level built at compile time
+Output: N/A
+Comments: Like LoadFromPack, only the data is already in the binary.
+****************************************************************************/
+void LevelData::LoadFromEmbedded(const EmbeddedLevelView &level) {
+    mWidth = level.width;
+    mHeight = level.height;
+    mStride = mWidth + 2;
+    mForeColor = level.foreColor;
+    mBackColor = level.backColor;
+    mAttribute = RenderEngine::AttributeFromAnsi(mForeColor, mBackColor);
+    mTotalDots = level.totalDots;
+
+    mTiles = level.tiles;
+    mDirectionMasks = level.directionMasks;
+
+    const int tileCount = mWidth * mHeight;
+    mWalkableBoard.AssignWords(level.walkable, tileCount);
+    mPelletBoard.AssignWords(level.pellet, tileCount);
+    mPowerPelletBoard.AssignWords(level.powerPellet, tileCount);
+    mNotFirstColumnBoard.AssignWords(level.notFirstColumn, tileCount);
+    mNotLastColumnBoard.AssignWords(level.notLastColumn, tileCount);
+} // END LoadFromEmbedded
+
+/****************************************************************************
+Function: LoadFromFile
+Parameter(s): const char * - Path of the level file
+Output: bool - Whether the level was read.
+Comments: The file holds the width, height, ANSI fore and back colours and
+          then one hex character code per tile, row by row.
+****************************************************************************/
+bool LevelData::LoadFromFile(const char *filename) {
+    // Read the whole file up front; the parse itself never allocates
+    FILE *mapFile = fopen(filename, "rb");
+    if (mapFile == nullptr) {
+        return false;
+    }
+    std::vector<char> text;
+    if (fseek(mapFile, 0, SEEK_END) == 0) {
+        long fileSize = ftell(mapFile);
+        if (fileSize > 0 && fseek(mapFile, 0, SEEK_SET) == 0) {
+            text.resize((size_t)fileSize);
+            text.resize(fread(&text[0], 1, text.size(), mapFile));
+        }
+    }
+    fclose(mapFile);
+
+    LevelTextParser parser(text.empty() ? "" : &text[0], text.size());
+    if (!ParseText(parser)) {
+        fprintf(stderr, "%s:%d: %s\n", filename, parser.getLine(), parser.getError());
+        return false;
+    }
+    BuildDerivedData();
+    return true;
+} // END LoadFromFile
+
+/****************************************************************************
+Function: ParseText
+Parameter(s): LevelTextParser & - Parser over the level text
+Output: bool - Whether the header and exactly width * height tiles were
+               read.  The parser holds the error otherwise.
+Comments: Tiles are written row by row straight into the padded grid.
+****************************************************************************/
+bool LevelData::ParseText(LevelTextParser &parser) {
+    if (!parser.ReadDecimal(mWidth, "width") || !parser.ReadDecimal(mHeight, "height") ||
+        !parser.ReadDecimal(mForeColor, "foreground colour") || !parser.ReadDecimal(mBackColor, "background colour")) {
+        return false;
+    }
+    if (mWidth <= 0 || mHeight <= 0 || mWidth > MAX_LEVEL_DIMENSION || mHeight > MAX_LEVEL_DIMENSION) {
+        return parser.Fail("dimensions %dx%d are outside 1x1 to %dx%d", mWidth, mHeight, MAX_LEVEL_DIMENSION, MAX_LEVEL_DIMENSION);
+    }
+    mAttribute = RenderEngine::AttributeFromAnsi(mForeColor, mBackColor);
+
+    mStride = mWidth + 2;
+    mOwnedTiles.assign((size_t)mStride * (mHeight + 2), SENTINEL_TILE);
+    mPelletBoard.Resize(mWidth * mHeight);
+    mPowerPelletBoard.Resize(mWidth * mHeight);
+
+    mTotalDots = 0;
+    int boardIndex = 0;
+    for (int i = 0; i < mHeight; ++i) {
+        char *row = &mOwnedTiles[TileIndex(0, i)];
+        for (int j = 0; j < mWidth; ++j, ++boardIndex) {
+            unsigned char tileValue;
+            if (!parser.ReadTile(tileValue, boardIndex)) {
+                return false;
+            }
+            char tile = (char)tileValue;
+            unsigned char tileClass = GetTileClass(tile);
+
+            // Pellets go to the bitboards, the tile underneath is open space
+            if (tileClass & TILE_PELLET) {
+                mPelletBoard.Set(boardIndex);
+                tile = ' ';
+                mTotalDots++;
+            }
+            else if (tileClass & TILE_POWER_PELLET) {
+                mPowerPelletBoard.Set(boardIndex);
+                tile = ' ';
+                mTotalDots++;
+            }
+            row[j] = tile;
+        }
+    }
+    return parser.ExpectEnd(boardIndex);
+} // END ParseText
+
+/****************************************************************************
+Function: BuildDerivedData
+Parameter(s): N/A
+Output: N/A
+Comments: Precomputes the walkable bitboard, the column masks and the
+          DIRECTION_BITS open from every tile.
+****************************************************************************/
+void LevelData::BuildDerivedData() {
+    mTiles = &mOwnedTiles[0];
+    mWalkableBoard.Resize(mWidth * mHeight);
+    mNotFirstColumnBoard.Resize(mWidth * mHeight);
+    mNotLastColumnBoard.Resize(mWidth * mHeight);
+    mOwnedDirectionMasks.assign((size_t)mWidth * mHeight, 0);
+    mDirectionMasks = &mOwnedDirectionMasks[0];
+
+    for (int i = 0; i < mHeight; ++i) {
+        for (int j = 0; j < mWidth; ++j) {
+            int boardIndex = i * mWidth + j;
+            mWalkableBoard.Assign(boardIndex, TileHasClass(mTiles[TileIndex(j, i)], TILE_WALKABLE));
+            mNotFirstColumnBoard.Assign(boardIndex, j != 0);
+            mNotLastColumnBoard.Assign(boardIndex, j != mWidth - 1);
+        }
+    }
+
+    for (int i = 0; i < mHeight; ++i) {
+        for (int j = 0; j < mWidth; ++j) {
+            const char *tile = &mTiles[TileIndex(j, i)];
+            unsigned mask = 0;
+            mask |= TileHasClass(tile[-1], TILE_WALKABLE) ? LEFT_BIT : 0;
+            mask |= TileHasClass(tile[1], TILE_WALKABLE) ? RIGHT_BIT : 0;
+            mask |= TileHasClass(tile[mStride], TILE_WALKABLE) ? DOWN_BIT : 0;
+            mask |= TileHasClass(tile[-mStride], TILE_WALKABLE) ? UP_BIT : 0;
+            mOwnedDirectionMasks[i * mWidth + j] = (unsigned char)mask;
+        }
+    }
+} // END BuildDerivedData
@@ -0,0 +1,87 @@
+/****************************************************************************
+File: LevelData.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _LEVEL_DATA_H_
+#define _LEVEL_DATA_H_
+
+#include "Bitboard.h"
+#include "Constants.h"
+#include "LevelPack.h"
+#include <memory>
+#include <vector>
+
+class LevelTextParser;
+struct EmbeddedLevelView;
+
+/****************************************************************************
+Class: LevelData
+Comments: Everything about a level that never changes while it is played:
+          the walls, filler and barrier tiles, the open directions of each
+          tile, the walkable tiles and the starting pellets.  Loaded once
+          per level number and shared read-only by every GameMap playing
+          it, so any number of concurrent games cost one copy per level.
+          Pellets are absent from the tile grid (open space instead), they
+          live in the pellet bitboards and each game keeps its own overlay.
+
+          Levels come from the compiled level pack when there is one; the
+          tile grid and direction masks are then used straight from the
+          mapped file.  Otherwise the text level is parsed into owned
+          storage.  Builds with PACMAN_EMBED_STOCK_LEVELS carry the stock
+          levels fully preprocessed in the binary (See @EmbeddedLevels.h).
+****************************************************************************/
+class LevelData {
+public:
+    // Fills the one tile border around the Map tiles
+    const static char SENTINEL_TILE = '\0';
+private:
+    int mWidth, mHeight, mStride, mTotalDots;
+    int mForeColor, mBackColor;
+    unsigned char mAttribute;
+
+    // Row-major tiles surrounded by a SENTINEL_TILE border, so the
+    // neighbours of any Map tile can be read without bounds checks.  Point
+    // into the level pack, or into the owned copies for text levels.
+    const char *mTiles;
+    const unsigned char *mDirectionMasks;
+    std::vector<char> mOwnedTiles;
+    std::vector<unsigned char> mOwnedDirectionMasks;
+    std::shared_ptr<const LevelPack> mPack;
+
+    // The column masks stop bitboard shifts from wrapping between rows
+    Bitboard mWalkableBoard, mPelletBoard, mPowerPelletBoard;
+    Bitboard mNotFirstColumnBoard, mNotLastColumnBoard;
+
+    LevelData();
+    LevelData(const LevelData &other);
+    LevelData &operator=(const LevelData &other);
+
+    bool LoadFromFile(const char *filename);
+    bool ParseText(LevelTextParser &parser);
+    void LoadFromPack(const std::shared_ptr<const LevelPack> &pack, const LevelPack::LevelRecord &record);
+    void LoadFromEmbedded(const EmbeddedLevelView &level);
+    void BuildDerivedData();
+public:
+    static std::shared_ptr<const LevelData> Load(int levelNumber);
+    static bool IsLoaded(int levelNumber);
+    static std::shared_ptr<const LevelData> LoadText(int levelNumber);
+
+    int getWidth() const { return mWidth; }
+    int getHeight() const { return mHeight; }
+    int getStride() const { return mStride; }
+    int getTotalDots() const { return mTotalDots; }
+    int getForeColor() const { return mForeColor; }
+    int getBackColor() const { return mBackColor; }
+    unsigned char getAttribute() const { return mAttribute; }
+
+    inline int TileIndex(int xPos, int yPos) const { return (yPos + 1) * mStride + xPos + 1; }
+    const char *getTiles() const { return mTiles; }
+    const unsigned char *getDirectionMasks() const { return mDirectionMasks; }
+
+    const Bitboard &getWalkableBoard() const { return mWalkableBoard; }
+    const Bitboard &getPelletBoard() const { return mPelletBoard; }
+    const Bitboard &getPowerPelletBoard() const { return mPowerPelletBoard; }
+    const Bitboard &getNotFirstColumnBoard() const { return mNotFirstColumnBoard; }
+    const Bitboard &getNotLastColumnBoard() const { return mNotLastColumnBoard; }
+};
+#endif // _LEVEL_DATA_H_
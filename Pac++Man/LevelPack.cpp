@@ -0,0 +1,301 @@
+/****************************************************************************
+File: LevelPack.cpp
+Author: fookenCode
+****************************************************************************/
+#include "LevelPack.h"
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "Constants.h"
+#include "LevelData.h"
+#ifdef _WIN32
+#include <Windows.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const char LEVEL_PACK_MAGIC[4] = { 'P', 'A', 'C', 'L' };
+
+static_assert(sizeof(LevelPack::Header) == 16, "LevelPack::Header layout changed");
+static_assert(sizeof(LevelPack::Entry) == 16, "LevelPack::Entry layout changed");
+static_assert(sizeof(LevelPack::LevelRecord) == 80, "LevelPack::LevelRecord layout changed");
+
+/****************************************************************************
+Function: AlignSection
+Parameter(s): size_t - Offset
+Output: size_t - Offset rounded up to the next 8 byte boundary.
+Comments: N/A
+****************************************************************************/
+static inline size_t AlignSection(size_t offset) {
+    return (offset + 7) & ~(size_t)7;
+} // END AlignSection
+
+#ifdef _WIN32
+LevelPack::LevelPack() : mBytes(nullptr), mSize(0), mFileHandle(INVALID_HANDLE_VALUE), mMappingHandle(nullptr) {
+}
+#else
+LevelPack::LevelPack() : mBytes(nullptr), mSize(0), mFileDescriptor(-1) {
+}
+#endif
+
+LevelPack::~LevelPack() {
+#ifdef _WIN32
+    if (mBytes != nullptr) {
+        UnmapViewOfFile(mBytes);
+    }
+    if (mMappingHandle != nullptr) {
+        CloseHandle(mMappingHandle);
+    }
+    if (mFileHandle != INVALID_HANDLE_VALUE) {
+        CloseHandle(mFileHandle);
+    }
+#else
+    if (mBytes != nullptr) {
+        munmap((void *)mBytes, mSize);
+    }
+    if (mFileDescriptor >= 0) {
+        close(mFileDescriptor);
+    }
+#endif
+}
+
+/****************************************************************************
+Function: Map
+Parameter(s): const char * - Path of the pack
+Output: bool - Whether the whole file is now mapped read-only.
+Comments: N/A
+****************************************************************************/
+bool LevelPack::Map(const char *filename) {
+#ifdef _WIN32
+    mFileHandle = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (mFileHandle == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(mFileHandle, &fileSize) || fileSize.QuadPart < (LONGLONG)sizeof(Header)) {
+        return false;
+    }
+    mMappingHandle = CreateFileMappingA(mFileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mMappingHandle == nullptr) {
+        return false;
+    }
+    mBytes = (const char *)MapViewOfFile(mMappingHandle, FILE_MAP_READ, 0, 0, 0);
+    mSize = (size_t)fileSize.QuadPart;
+#else
+    mFileDescriptor = open(filename, O_RDONLY);
+    if (mFileDescriptor < 0) {
+        return false;
+    }
+    struct stat fileInfo;
+    if (fstat(mFileDescriptor, &fileInfo) != 0 || fileInfo.st_size < (off_t)sizeof(Header)) {
+        return false;
+    }
+    void *mapping = mmap(nullptr, (size_t)fileInfo.st_size, PROT_READ, MAP_PRIVATE, mFileDescriptor, 0);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    mBytes = (const char *)mapping;
+    mSize = (size_t)fileInfo.st_size;
+#endif
+    return mBytes != nullptr;
+} // END Map
+
+/****************************************************************************
+Function: Open
+Parameter(s): const char * - Path of the pack
+Output: std::shared_ptr<const LevelPack> - The mapped pack, or empty when
+                                           it is missing or not a valid
+                                           pack of this version.
+Comments: Levels taken from the pack keep it mapped for as long as they
+          are alive.
+****************************************************************************/
+std::shared_ptr<const LevelPack> LevelPack::Open(const char *filename) {
+    std::shared_ptr<LevelPack> pack(new LevelPack());
+    if (!pack->Map(filename)) {
+        return std::shared_ptr<const LevelPack>();
+    }
+
+    const Header *header = (const Header *)pack->mBytes;
+    if (memcmp(header->magic, LEVEL_PACK_MAGIC, sizeof(LEVEL_PACK_MAGIC)) != 0 || header->version != FORMAT_VERSION ||
+        header->levelCount > (pack->mSize - sizeof(Header)) / sizeof(Entry)) {
+        fprintf(stderr, "%s is not a version %u level pack, ignoring it\n", filename, (unsigned)FORMAT_VERSION);
+        return std::shared_ptr<const LevelPack>();
+    }
+    return pack;
+} // END Open
+
+/****************************************************************************
+Function: ValidateRecord
+Parameter(s): const Entry & - Directory entry of the level
+Output: bool - Whether every section of the record lies inside it.
+Comments: A truncated or corrupted pack must never be read out of bounds.
+****************************************************************************/
+bool LevelPack::ValidateRecord(const Entry &entry) const {
+    if (entry.offset % 8 != 0 || entry.size < sizeof(LevelRecord) ||
+        entry.offset > mSize || entry.size > mSize - entry.offset) {
+        return false;
+    }
+
+    const LevelRecord *record = (const LevelRecord *)(mBytes + entry.offset);
+    if (record->width == 0 || record->height == 0 || record->width > MAX_LEVEL_DIMENSION || record->height > MAX_LEVEL_DIMENSION) {
+        return false;
+    }
+    size_t tileCount = (size_t)record->width * record->height;
+    size_t boardBytes = (size_t)record->boardWords * sizeof(uint64_t);
+    if (record->boardWords != (tileCount + 63) / 64) {
+        return false;
+    }
+
+    const uint32_t offsets[] = { record->tilesOffset, record->directionMasksOffset, record->walkableOffset,
+                                 record->pelletOffset, record->powerPelletOffset, record->notFirstColumnOffset, record->notLastColumnOffset };
+    const size_t lengths[] = { (size_t)(record->width + 2) * (record->height + 2), tileCount, boardBytes,
+                               boardBytes, boardBytes, boardBytes, boardBytes };
+    for (size_t i = 0; i < sizeof(offsets) / sizeof(offsets[0]); ++i) {
+        if (offsets[i] % 8 != 0 || offsets[i] > entry.size || lengths[i] > entry.size - offsets[i]) {
+            return false;
+        }
+    }
+    return true;
+} // END ValidateRecord
+
+/****************************************************************************
+Function: FindLevel
+Parameter(s): int - Level number
+Output: const LevelRecord * - The level inside the mapping, or nullptr
+                              when the pack has no (valid) such level.
+Comments: N/A
+****************************************************************************/
+const LevelPack::LevelRecord *LevelPack::FindLevel(int levelNumber) const {
+    const Header *header = (const Header *)mBytes;
+    const Entry *entries = (const Entry *)(mBytes + sizeof(Header));
+    for (uint32_t i = 0; i < header->levelCount; ++i) {
+        if (entries[i].levelNumber == levelNumber) {
+            if (!ValidateRecord(entries[i])) {
+                fprintf(stderr, "Level %d in the level pack is damaged, ignoring it\n", levelNumber);
+                return nullptr;
+            }
+            return (const LevelRecord *)(mBytes + entries[i].offset);
+        }
+    }
+    return nullptr;
+} // END FindLevel
+
+/****************************************************************************
+Function: ReadSourceStamp
+Parameter(s): const char * - Path of a text level
+              uint64_t & - Receives its size in bytes
+              int64_t & - Receives its modification time in seconds
+Output: bool - Whether the file exists.
+Comments: Stored in every LevelRecord, so a text level edited after the
+          pack was compiled is noticed.
+****************************************************************************/
+bool LevelPack::ReadSourceStamp(const char *filename, uint64_t &size, int64_t &modified) {
+#ifdef _WIN32
+    struct _stat64 fileInfo;
+    if (_stat64(filename, &fileInfo) != 0) {
+        return false;
+    }
+#else
+    struct stat fileInfo;
+    if (stat(filename, &fileInfo) != 0) {
+        return false;
+    }
+#endif
+    size = (uint64_t)fileInfo.st_size;
+    modified = (int64_t)fileInfo.st_mtime;
+    return true;
+} // END ReadSourceStamp
+
+/****************************************************************************
+Function: Compile
+Parameter(s): const char * - Path of the pack to write
+              int & - Receives the number of levels written
+Output: bool - Whether the pack was written.
+Comments: Reads the text levels 1, 2, ... until one is missing and writes
+          them with all of their precomputed data as one pack.
+****************************************************************************/
+bool LevelPack::Compile(const char *filename, int &levelsWritten) {
+    std::vector<std::shared_ptr<const LevelData> > levels;
+    for (int levelNumber = 1; levelNumber <= MAX_LEVEL_NUMBER; ++levelNumber) {
+        std::shared_ptr<const LevelData> level = LevelData::LoadText(levelNumber);
+        if (!level) {
+            break;
+        }
+        levels.push_back(level);
+    }
+    levelsWritten = 0;
+    if (levels.empty()) {
+        return false;
+    }
+
+    std::vector<char> pack(AlignSection(sizeof(Header) + sizeof(Entry) * levels.size()), 0);
+    Header header;
+    memcpy(header.magic, LEVEL_PACK_MAGIC, sizeof(header.magic));
+    header.version = FORMAT_VERSION;
+    header.levelCount = (uint32_t)levels.size();
+    header.reserved = 0;
+    memcpy(&pack[0], &header, sizeof(header));
+
+    for (size_t i = 0; i < levels.size(); ++i) {
+        const LevelData &level = *levels[i];
+        const int tileCount = level.getWidth() * level.getHeight();
+        const size_t tileBytes = (size_t)level.getStride() * (level.getHeight() + 2);
+        const size_t boardBytes = (size_t)level.getWalkableBoard().getWordCount() * sizeof(uint64_t);
+
+        LevelRecord record;
+        memset(&record, 0, sizeof(record));
+        record.width = level.getWidth();
+        record.height = level.getHeight();
+        record.foreColor = level.getForeColor();
+        record.backColor = level.getBackColor();
+        record.attribute = level.getAttribute();
+        record.totalDots = level.getTotalDots();
+        char sourceFilename[256];
+        snprintf(sourceFilename, sizeof(sourceFilename), LEVEL_FILENAME_TEMPLATE, (int)(i + 1));
+        ReadSourceStamp(sourceFilename, record.sourceSize, record.sourceModified);
+        record.boardWords = level.getWalkableBoard().getWordCount();
+
+        size_t offset = AlignSection(sizeof(LevelRecord));
+        record.tilesOffset = (uint32_t)offset;            offset = AlignSection(offset + tileBytes);
+        record.directionMasksOffset = (uint32_t)offset;   offset = AlignSection(offset + tileCount);
+        record.walkableOffset = (uint32_t)offset;         offset += boardBytes;
+        record.pelletOffset = (uint32_t)offset;           offset += boardBytes;
+        record.powerPelletOffset = (uint32_t)offset;      offset += boardBytes;
+        record.notFirstColumnOffset = (uint32_t)offset;   offset += boardBytes;
+        record.notLastColumnOffset = (uint32_t)offset;    offset += boardBytes;
+
+        size_t recordStart = pack.size();
+        pack.resize(recordStart + offset, 0);
+        char *bytes = &pack[recordStart];
+        memcpy(bytes, &record, sizeof(record));
+        memcpy(bytes + record.tilesOffset, level.getTiles(), tileBytes);
+        memcpy(bytes + record.directionMasksOffset, level.getDirectionMasks(), tileCount);
+        memcpy(bytes + record.walkableOffset, level.getWalkableBoard().getWords(), boardBytes);
+        memcpy(bytes + record.pelletOffset, level.getPelletBoard().getWords(), boardBytes);
+        memcpy(bytes + record.powerPelletOffset, level.getPowerPelletBoard().getWords(), boardBytes);
+        memcpy(bytes + record.notFirstColumnOffset, level.getNotFirstColumnBoard().getWords(), boardBytes);
+        memcpy(bytes + record.notLastColumnOffset, level.getNotLastColumnBoard().getWords(), boardBytes);
+
+        Entry entry;
+        entry.levelNumber = (int32_t)(i + 1);
+        entry.offset = (uint32_t)recordStart;
+        entry.size = (uint32_t)offset;
+        entry.reserved = 0;
+        memcpy(&pack[sizeof(Header) + i * sizeof(Entry)], &entry, sizeof(entry));
+    }
+
+    FILE *output = fopen(filename, "wb");
+    if (output == nullptr) {
+        return false;
+    }
+    bool written = fwrite(&pack[0], 1, pack.size(), output) == pack.size();
+    written = (fclose(output) == 0) && written;
+    if (written) {
+        levelsWritten = (int)levels.size();
+    }
+    return written;
+} // END Compile
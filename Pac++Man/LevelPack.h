@@ -0,0 +1,79 @@
+/****************************************************************************
+File: LevelPack.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _LEVEL_PACK_H_
+#define _LEVEL_PACK_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/****************************************************************************
+Class: LevelPack
+Comments: All levels compiled into one binary file that is memory-mapped
+          and used in place.  Layout (little-endian, sections 8 byte
+          aligned):
+            Header          magic "PACL", FORMAT_VERSION, level count
+            Entry[count]    level number, offset and size of its record
+            LevelRecord...  dimensions, colours, the size and
+                            modification time of the text level it was
+                            compiled from, and the offsets
+                            (from the record start) of the padded tile
+                            grid, direction masks and bitboard words
+          Built offline with "--compile-levels" from the text levels.
+****************************************************************************/
+class LevelPack {
+public:
+    const static uint32_t FORMAT_VERSION = 4;
+
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint32_t levelCount;
+        uint32_t reserved;
+    };
+
+    struct Entry {
+        int32_t levelNumber;
+        uint32_t offset;
+        uint32_t size;
+        uint32_t reserved;
+    };
+
+    struct LevelRecord {
+        uint32_t width, height, foreColor, backColor;
+        uint32_t attribute, totalDots;
+        uint64_t sourceSize;
+        int64_t sourceModified;
+        uint32_t boardWords;
+        uint32_t tilesOffset, directionMasksOffset;
+        uint32_t walkableOffset, pelletOffset, powerPelletOffset;
+        uint32_t notFirstColumnOffset, notLastColumnOffset;
+        uint32_t reserved[2];
+    };
+private:
+    const char *mBytes;
+    size_t mSize;
+#ifdef _WIN32
+    void *mFileHandle, *mMappingHandle;
+#else
+    int mFileDescriptor;
+#endif
+
+    LevelPack();
+    LevelPack(const LevelPack &other);
+    LevelPack &operator=(const LevelPack &other);
+
+    bool Map(const char *filename);
+    bool ValidateRecord(const Entry &entry) const;
+public:
+    ~LevelPack();
+
+    static std::shared_ptr<const LevelPack> Open(const char *filename);
+    static bool Compile(const char *filename, int &levelsWritten);
+    static bool ReadSourceStamp(const char *filename, uint64_t &size, int64_t &modified);
+
+    const LevelRecord *FindLevel(int levelNumber) const;
+};
+#endif // _LEVEL_PACK_H_
@@ -0,0 +1,157 @@
+/****************************************************************************
+File: LevelTextParser.cpp
+Author: fookenCode
+****************************************************************************/
+#include "LevelTextParser.h"
+#include <cstdarg>
+#include <cstdio>
+#include <utility>
+
+enum TEXT_CHARACTER_CLASSES {
+    CHARACTER_DIGIT_MASK    = 0x0F,
+    CHARACTER_HEX_DIGIT     = 0x10,
+    CHARACTER_SPACE         = 0x20,
+    CHARACTER_NEWLINE       = 0x40
+};
+
+/****************************************************************************
+Function: ClassifyCharacter
+Parameter(s): char - Character of the level text
+Output: unsigned char - TEXT_CHARACTER_CLASSES flags, with the digit value
+                        in the low nibble of hex digits.
+Comments: Only evaluated at compile time to fill CHARACTER_CLASS_TABLE.
+****************************************************************************/
+constexpr unsigned char ClassifyCharacter(char character) {
+    return (character >= '0' && character <= '9') ? (CHARACTER_HEX_DIGIT | (character - '0')) :
+           (character >= 'a' && character <= 'f') ? (CHARACTER_HEX_DIGIT | (character - 'a' + 10)) :
+           (character >= 'A' && character <= 'F') ? (CHARACTER_HEX_DIGIT | (character - 'A' + 10)) :
+           (character == '\n') ? (CHARACTER_SPACE | CHARACTER_NEWLINE) :
+           (character == ' ' || character == '\r' || character == '\t' || character == '\v' || character == '\f') ? CHARACTER_SPACE : 0;
+} // END ClassifyCharacter
+
+struct CharacterClassTable {
+    unsigned char flags[256];
+};
+
+template <size_t... Index>
+constexpr CharacterClassTable MakeCharacterClassTable(std::index_sequence<Index...>) {
+    return CharacterClassTable{ { ClassifyCharacter((char)Index)... } };
+} // END MakeCharacterClassTable
+
+// Flags for every possible byte of the text, indexed by (unsigned char)character
+constexpr CharacterClassTable CHARACTER_CLASS_TABLE = MakeCharacterClassTable(std::make_index_sequence<256>());
+
+static_assert(CHARACTER_CLASS_TABLE.flags['b'] == (CHARACTER_HEX_DIGIT | 0xB), "Hex digit missing from CHARACTER_CLASS_TABLE");
+static_assert(CHARACTER_CLASS_TABLE.flags['x'] == 0, "CHARACTER_CLASS_TABLE classifies 'x'");
+
+static inline unsigned char GetCharacterClass(char character) { return CHARACTER_CLASS_TABLE.flags[(unsigned char)character]; }
+
+LevelTextParser::LevelTextParser(const char *text, size_t length) : mCursor(text), mEnd(text + length), mLine(1) {
+    mError[0] = '\0';
+}
+
+/****************************************************************************
+Function: NextToken
+Parameter(s): const char *& - Receives the start of the token
+Output: bool - False at the end of the text.
+Comments: Skips the whitespace in front of the token, counting lines, and
+          leaves the cursor on its first character.
+****************************************************************************/
+bool LevelTextParser::NextToken(const char *&tokenStart) {
+    unsigned char characterClass;
+    while (mCursor < mEnd && ((characterClass = GetCharacterClass(*mCursor)) & CHARACTER_SPACE)) {
+        mLine += (characterClass & CHARACTER_NEWLINE) ? 1 : 0;
+        mCursor++;
+    }
+    tokenStart = mCursor;
+    return mCursor < mEnd;
+} // END NextToken
+
+/****************************************************************************
+Function: Fail
+Parameter(s): const char * - printf style message
+              ... - Message arguments
+Output: bool - Always false, so callers can return Fail(...).
+Comments: N/A
+****************************************************************************/
+bool LevelTextParser::Fail(const char *format, ...) {
+    va_list arguments;
+    va_start(arguments, format);
+    vsnprintf(mError, sizeof(mError), format, arguments);
+    va_end(arguments);
+    return false;
+} // END Fail
+
+/****************************************************************************
+Function: ReadDecimal
+Parameter(s): int & - Receives the value
+              const char * - Name of the field, for the error message
+Output: bool - Whether a non-negative decimal number was read.
+Comments: N/A
+****************************************************************************/
+bool LevelTextParser::ReadDecimal(int &value, const char *fieldName) {
+    const char *tokenStart;
+    if (!NextToken(tokenStart)) {
+        return Fail("missing %s", fieldName);
+    }
+
+    value = 0;
+    while (mCursor < mEnd && *mCursor >= '0' && *mCursor <= '9') {
+        if (value > 99999999) {
+            return Fail("%s is too large", fieldName);
+        }
+        value = value * 10 + (*mCursor++ - '0');
+    }
+    if (mCursor == tokenStart || (mCursor < mEnd && !(GetCharacterClass(*mCursor) & CHARACTER_SPACE))) {
+        return Fail("%s must be a decimal number", fieldName);
+    }
+    return true;
+} // END ReadDecimal
+
+/****************************************************************************
+Function: ReadTile
+Parameter(s): unsigned char & - Receives the tile
+              int - Zero-based number of the tile, for the error message
+Output: bool - Whether a hex tile between 0x00 and 0xFF was read.
+Comments: The "0x" prefix is optional, as it was for the stream parser.
+****************************************************************************/
+bool LevelTextParser::ReadTile(unsigned char &tile, int tileNumber) {
+    const char *tokenStart;
+    if (!NextToken(tokenStart)) {
+        return Fail("expected more tiles, the grid ends after %d", tileNumber);
+    }
+
+    if (mEnd - mCursor > 2 && mCursor[0] == '0' && (mCursor[1] == 'x' || mCursor[1] == 'X') &&
+        (GetCharacterClass(mCursor[2]) & CHARACTER_HEX_DIGIT)) {
+        mCursor += 2;
+    }
+    unsigned value = 0;
+    unsigned char characterClass = 0;
+    const char *digitStart = mCursor;
+    while (mCursor < mEnd && ((characterClass = GetCharacterClass(*mCursor)) & CHARACTER_HEX_DIGIT)) {
+        value = (value << 4) | (characterClass & CHARACTER_DIGIT_MASK);
+        mCursor++;
+        if (value > 0xFF) {
+            return Fail("tile %d is larger than 0xFF", tileNumber);
+        }
+    }
+    if (mCursor == digitStart || (mCursor < mEnd && !(characterClass & CHARACTER_SPACE))) {
+        return Fail("tile %d is not a hex number", tileNumber);
+    }
+    tile = (unsigned char)value;
+    return true;
+} // END ReadTile
+
+/****************************************************************************
+Function: ExpectEnd
+Parameter(s): int - Number of tiles the header promised
+Output: bool - Whether only whitespace follows the grid.
+Comments: N/A
+****************************************************************************/
+bool LevelTextParser::ExpectEnd(int tileCount) {
+    const char *tokenStart;
+    if (NextToken(tokenStart)) {
+        return Fail("more than the %d tiles given by the dimensions", tileCount);
+    }
+    return true;
+} // END ExpectEnd
@@ -0,0 +1,39 @@
+/****************************************************************************
+File: LevelTextParser.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _LEVEL_TEXT_PARSER_H_
+#define _LEVEL_TEXT_PARSER_H_
+
+#include <cstddef>
+
+/****************************************************************************
+Class: LevelTextParser
+Comments: Single pass tokenizer over a text level already held in memory:
+            <width> <height> <foreColor> <backColor>
+            <width * height hex tiles, e.g. 0xC9 or C9>
+          Numbers are decoded by hand, so the parse neither allocates nor
+          depends on the locale.  On failure getError() describes what was
+          wrong and getLine() where.
+****************************************************************************/
+class LevelTextParser {
+private:
+    const static int MAX_ERROR_LENGTH = 160;
+
+    const char *mCursor, *mEnd;
+    int mLine;
+    char mError[MAX_ERROR_LENGTH];
+
+    bool NextToken(const char *&tokenStart);
+public:
+    LevelTextParser(const char *text, size_t length);
+
+    bool ReadDecimal(int &value, const char *fieldName);
+    bool ReadTile(unsigned char &tile, int tileNumber);
+    bool ExpectEnd(int tileCount);
+    bool Fail(const char *format, ...);
+
+    const char *getError() const { return mError; }
+    int getLine() const { return mLine; }
+};
+#endif // _LEVEL_TEXT_PARSER_H_
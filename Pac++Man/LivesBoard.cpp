@@ -1,9 +1,8 @@
 #include "LivesBoard.h"
-#include <Windows.h>
-#include <iostream>
+#include "RenderEngine.h"
+#include <cstdio>
 
 LivesBoard::LivesBoard(): livesLeft(MAX_VISIBLE_LIVES) {
-    setInvalidated(true);
 }
 
 LivesBoard::~LivesBoard() {
@@ -12,28 +11,18 @@ LivesBoard::~LivesBoard() {
 
 /****************************************************************************
 Function: Render
-Parameter(s): N/A
+Parameter(s): RenderEngine & - Engine whose back buffer is drawn into.
 Output: N/A
 Comments: Renders the number of Player lives that are currently Active.
 ****************************************************************************/
-void LivesBoard::Render() {
-    if (isInvalidated) {
-        COORD Position;
-        Position.X = (int)xPos;
-        Position.Y = (int)yPos;
-        SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), Position);
-        std::cout << "\033[40;37;1m" << LIVES_NAME_TEXT;
-        Position.Y += 1;
-        SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), Position);
-        int displayAmount = (livesLeft < 0) ? 0 : livesLeft;
-        std::cout << "\033[33;1m" << LIVES_BOARD_CHARACTER << " x " << displayAmount << "\033[0m";
-
-        // Reset the Invalidated flag
-        isInvalidated = false;
-    }
+void LivesBoard::Render(RenderEngine &engine) {
+    char livesText[32];
+    int displayAmount = (livesLeft < 0) ? 0 : livesLeft;
+    snprintf(livesText, sizeof(livesText), "%c x %-*d", LIVES_BOARD_CHARACTER, BOARD_VALUE_WIDTH - 4, displayAmount);
+    engine.DrawString((int)xPos, (int)yPos, LIVES_NAME_TEXT, ATTR_BOARD_TEXT);
+    engine.DrawString((int)xPos, (int)yPos + 1, livesText, ATTR_HIGHLIGHT_TEXT);
 } // END Render
 
 void LivesBoard::Reset() {
     livesLeft = MAX_VISIBLE_LIVES;
-    isInvalidated = false;
-} // END Reset
\ No newline at end of file
+} // END Reset
@@ -13,13 +13,13 @@ public:
     int getLivesLeft() { return livesLeft; }
     int getMaxLives() { return maxLives; }
 
-    void setLivesLeft(int newLivesTotal) { livesLeft = newLivesTotal; setInvalidated(true); }
-    inline void decLives() { livesLeft--; setInvalidated(true); }
-    inline void incLives() { livesLeft++; setInvalidated(true); }
+    void setLivesLeft(int newLivesTotal) { livesLeft = newLivesTotal; }
+    inline void decLives() { livesLeft--; }
+    inline void incLives() { livesLeft++; }
 
     void setMaxLives(int newMaxLivesTotal) { maxLives = newMaxLivesTotal; }
 
-    virtual void Render();
+    virtual void Render(RenderEngine &engine);
     virtual void Reset();
 };
 
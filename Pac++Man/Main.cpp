@@ -3,79 +3,550 @@ File: Main.cpp
 Author: fookenCode
 ****************************************************************************/
 #include <iostream>
-#include <ctime>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
 using namespace std;
-#include <windows.h>
+#include "BatchRunner.h"
+#include "EmbeddedLevels.h"
+#include "FrameProfiler.h"
+#include "Console.h"
+#include "InputPolicies.h"
+#include "LevelData.h"
+#include "LevelPack.h"
+#include "MctsInput.h"
+#include "Metrics.h"
 #include "PacGame.h"
+#include "Replay.h"
+#include "TraceRecorder.h"
 
-int main(int args, char *argv)
+/****************************************************************************
+Function: RunHeadless
+Parameter(s): unsigned - Number of simulation ticks to run.
+Output: int - Process exit code.
+Comments: Steps a headless game driven by a scripted player as fast as the
+          CPU allows and reports the simulation throughput.
+****************************************************************************/
+static int RunHeadless(unsigned ticksToRun)
+{
+    RandomWalkInput input(1);
+    PacGame game(&input, true);
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (unsigned i = 0; i < ticksToRun; ++i) {
+        game.Step();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    printf("%u ticks in %.3f s (%.0f ticks/sec)\n", ticksToRun, seconds, seconds > 0.0 ? ticksToRun / seconds : 0.0);
+    printf("Level %d, Score %ld, Lives %d\n", game.mGameMap.getCurrentLevel(), game.mScoreBoard.getScoreTotal(), game.mLivesBoard.getLivesLeft());
+    return EXIT_SUCCESS;
+}
+
+/****************************************************************************
+Function: TimeKernel
+Parameter(s): GameMap & - Map of the level being measured
+              bool - Whether the fixed-dimension kernels may be used
+              unsigned - Number of repetitions
+              const std::function<void()> & - One run of the kernel
+Output: double - Nanoseconds per run.
+Comments: N/A
+****************************************************************************/
+static double TimeKernel(GameMap &map, bool fixedGrid, unsigned iterations, const function<void()> &kernel)
+{
+    map.setFixedGridEnabled(fixedGrid);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (unsigned i = 0; i < iterations; ++i) {
+        kernel();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    map.setFixedGridEnabled(true);
+    return seconds * 1e9 / iterations;
+}
+
+/****************************************************************************
+Function: RunBench
+Parameter(s): unsigned - Number of repetitions of each kernel
+Output: int - Process exit code.
+Comments: --bench [iterations]
+          Times the map kernels on level 1, once through the kernels built
+          for the stock dimensions and once through the runtime-sized
+          fallback, and reports the speedup.  Then times saving and
+          restoring a GameSnapshot.
+****************************************************************************/
+static int RunBench(unsigned iterations)
+{
+    PacGame game(nullptr, true);
+    GameMap &map = game.mGameMap;
+    RenderEngine engine;
+    engine.InitializeEngine();
+
+    // Pathing: walkable flood steps from the pellets, as the greedy player does
+    Bitboard reached = map.getPelletBoard(), expanded;
+    int checksum = 0;
+    function<void()> pathing = [&]() {
+        map.expandWalkable(reached, expanded);
+        map.expandWalkable(expanded, reached);
+        checksum += (int)reached.Any();
+    };
+    function<void()> rendering = [&]() {
+        map.renderMap(engine, true);
+    };
+
+    printf("Level %d (%dx%d), %u iterations, %s\n", map.getCurrentLevel(), map.getMapWidth(), map.getMapHeight(), iterations,
+           map.isUsingFixedGrid() ? "stock dimensions" : "not stock sized, both runs use the runtime kernels");
+    printf("%-12s %12s %12s %9s\n", "Kernel", "Runtime ns", "Fixed ns", "Speedup");
+
+    const char *names[] = { "Pathing", "Rendering" };
+    function<void()> *kernels[] = { &pathing, &rendering };
+    for (int i = 0; i < 2; ++i) {
+        reached = map.getPelletBoard();
+        double runtimeNs = TimeKernel(map, false, iterations, *kernels[i]);
+        reached = map.getPelletBoard();
+        double fixedNs = TimeKernel(map, true, iterations, *kernels[i]);
+        printf("%-12s %12.1f %12.1f %8.2fx\n", names[i], runtimeNs, fixedNs, fixedNs > 0.0 ? runtimeNs / fixedNs : 0.0);
+    }
+
+    // Snapshots of the whole game, what rewinding or cloning a game costs
+    GameSnapshot snapshot;
+    function<void()> saveSnapshot = [&]() {
+        checksum += (int)game.SaveSnapshot(snapshot);
+    };
+    function<void()> restoreSnapshot = [&]() {
+        checksum += (int)game.RestoreSnapshot(snapshot);
+    };
+    printf("%-12s %12.1f ns (%u bytes)\n", "Snapshot", TimeKernel(map, true, iterations, saveSnapshot), (unsigned)sizeof(snapshot));
+    printf("%-12s %12.1f ns\n", "Restore", TimeKernel(map, true, iterations, restoreSnapshot));
+    return (checksum >= 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/****************************************************************************
+Function: RunBatch
+Parameter(s): int - Argument count
+              char *[] - Arguments following "--batch"
+Output: int - Process exit code.
+Comments: --batch <sessions> [-threads N] [-ticks N] [-level N]
+                  [-policy random|greedy] [-trace output.json]
+                  [-metrics file|unix:path]
+          Sessions get consecutive seeds; without -level and -policy they
+          cycle over both stock levels and both input policies.  -trace
+          writes the last spans of every worker thread as a Chrome trace;
+          -metrics reports the Metrics counters every
+          METRICS_REPORT_INTERVAL_SECONDS and once more at the end.
+****************************************************************************/
+static int RunBatch(int argc, char *argv[])
+{
+    unsigned sessionCount = (argc > 0) ? (unsigned)strtoul(argv[0], nullptr, 10) : 1000;
+    unsigned workerCount = 0, maxTicks = DEFAULT_SESSION_TICK_LIMIT;
+    int level = 0, policy = -1;
+    const char *traceFilename = nullptr, *metricsTarget = nullptr;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "-threads") == 0) {
+            workerCount = (unsigned)strtoul(argv[i + 1], nullptr, 10);
+        }
+        else if (strcmp(argv[i], "-ticks") == 0) {
+            maxTicks = (unsigned)strtoul(argv[i + 1], nullptr, 10);
+        }
+        else if (strcmp(argv[i], "-level") == 0) {
+            level = atoi(argv[i + 1]);
+        }
+        else if (strcmp(argv[i], "-policy") == 0) {
+            policy = (strcmp(argv[i + 1], "greedy") == 0) ? POLICY_GREEDY_PELLET : POLICY_RANDOM_WALK;
+        }
+        else if (strcmp(argv[i], "-trace") == 0) {
+            traceFilename = argv[i + 1];
+        }
+        else if (strcmp(argv[i], "-metrics") == 0) {
+            metricsTarget = argv[i + 1];
+        }
+    }
+    TraceRecorder::SetEnabled(traceFilename != nullptr);
+    MetricsReporter metricsReporter;
+    if (metricsTarget != nullptr && !metricsReporter.Start(metricsTarget, METRICS_REPORT_INTERVAL_SECONDS)) {
+        fprintf(stderr, "Could not report metrics to %s\n", metricsTarget);
+        return EXIT_FAILURE;
+    }
+
+    BatchRunner runner;
+    for (unsigned i = 0; i < sessionCount; ++i) {
+        BatchRunner::SessionConfig config;
+        config.seed = i + 1;
+        config.maxTicks = maxTicks;
+        config.startLevel = (level > 0) ? level : 1 + (int)(i % 2);
+        config.inputPolicy = (policy >= 0) ? policy : (int)((i / 2) % MAX_POLICY);
+        runner.AddSession(config);
+    }
+
+    BatchRunner::PrintSummary(runner.Run(workerCount));
+    metricsReporter.Stop();
+    if (traceFilename != nullptr && !TraceRecorder::WriteChromeTrace(traceFilename)) {
+        fprintf(stderr, "Could not write %s\n", traceFilename);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+/****************************************************************************
+Function: RunMctsBench
+Parameter(s): unsigned - Number of game ticks to play
+              int - Search iterations per decision
+Output: int - Process exit code.
+Comments: --mcts-bench [ticks] [iterations]
+          Plays a headless game with the MctsInput player.  Every decision
+          restores and steps a copy of the game thousands of times, so the
+          rollout rate tracks the speed of Update() and CheckCollisions()
+          end to end.  The seeds are fixed: the Level and Score reached
+          only change when the simulation does.
+****************************************************************************/
+static int RunMctsBench(unsigned ticksToRun, int iterations)
+{
+    PacGame game(nullptr, true);
+    MctsInput input(&game, 1, iterations);
+    game.setInputSource(&input);
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (unsigned i = 0; i < ticksToRun; ++i) {
+        game.Step();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    const LatencyHistogram &latency = input.getDecisionLatency();
+    printf("%u ticks in %.3f s, %llu decisions of %d iterations\n", ticksToRun, seconds, input.getDecisionCount(), iterations);
+    printf("Rollouts:   %llu (%.0f/sec), %llu simulated ticks (%.0f/sec)\n", input.getRolloutCount(),
+           seconds > 0.0 ? input.getRolloutCount() / seconds : 0.0, input.getRolloutTicks(),
+           seconds > 0.0 ? input.getRolloutTicks() / seconds : 0.0);
+    printf("Decisions:  p50 %.3f ms, p99 %.3f ms, max %.3f ms\n", latency.Percentile(50.0) / 1e6,
+           latency.Percentile(99.0) / 1e6, latency.getMax() / 1e6);
+    printf("Level %d, Score %ld, Lives %d\n", game.mGameMap.getCurrentLevel(), game.mScoreBoard.getScoreTotal(), game.mLivesBoard.getLivesLeft());
+    return EXIT_SUCCESS;
+}
+
+/****************************************************************************
+Function: RunReplay
+Parameter(s): const char * - Replay to play
+              unsigned - Number of times to play it
+Output: int - Process exit code.
+Comments: --replay-fast <replay> [repeats]
+          Plays a recorded session headless, as fast as the CPU allows,
+          and reports where it ended up and the best time taken.  Every
+          run must end in the same place, or the simulation is not
+          deterministic.
+****************************************************************************/
+static int RunReplay(const char *filename, unsigned repeats)
+{
+    ReplayInput replay;
+    if (!replay.Load(filename)) {
+        return EXIT_FAILURE;
+    }
+
+    double bestSeconds = 0.0;
+    long firstScore = 0;
+    int firstLevel = 0, firstLives = 0;
+    for (unsigned run = 0; run < repeats; ++run) {
+        ReplayInput input = replay;
+        PacGame game(&input, true);
+        game.setRandomSeed(replay.getSeed());
+        if (replay.getStartLevel() != game.mGameMap.getCurrentLevel()) {
+            game.SetStartingLevel(replay.getStartLevel());
+        }
+
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        while (game.getGameTicks() < replay.getTickCount()) {
+            game.Step();
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        if (run == 0 || seconds < bestSeconds) {
+            bestSeconds = seconds;
+        }
+
+        long score = game.mScoreBoard.getScoreTotal();
+        int level = game.mGameMap.getCurrentLevel(), lives = game.mLivesBoard.getLivesLeft();
+        if (run == 0) {
+            firstScore = score;
+            firstLevel = level;
+            firstLives = lives;
+        }
+        else if (score != firstScore || level != firstLevel || lives != firstLives) {
+            fprintf(stderr, "Run %u diverged: Level %d, Score %ld, Lives %d\n", run + 1, level, score, lives);
+            return EXIT_FAILURE;
+        }
+    }
+
+    printf("%u ticks x %u runs, best %.3f ms (%.0f ticks/sec, %.0fx real time)\n", replay.getTickCount(), repeats,
+           bestSeconds * 1000.0, bestSeconds > 0.0 ? replay.getTickCount() / bestSeconds : 0.0,
+           bestSeconds > 0.0 ? replay.getTickCount() * (MILLISECONDS_PER_TICK / 1000.0) / bestSeconds : 0.0);
+    printf("Level %d, Score %ld, Lives %d\n", firstLevel, firstScore, firstLives);
+    return EXIT_SUCCESS;
+}
+
+/****************************************************************************
+Function: CompileLevels
+Parameter(s): const char * - Path of the level pack to write
+Output: int - Process exit code.
+Comments: --compile-levels [output]
+          Compiles every text level into the binary level pack the game
+          maps at start-up.
+****************************************************************************/
+static int CompileLevels(const char *filename)
+{
+    int levelsWritten = 0;
+    if (!LevelPack::Compile(filename, levelsWritten)) {
+        fprintf(stderr, "Could not write level pack %s\n", filename);
+        return EXIT_FAILURE;
+    }
+    printf("Wrote %d levels to %s\n", levelsWritten, filename);
+    return EXIT_SUCCESS;
+}
+
+/****************************************************************************
+Function: EmbedLevels
+Parameter(s): const char * - Path of the header to write
+Output: int - Process exit code.
+Comments: --embed-levels [output]
+          Regenerates StockLevels.h, the levels built into the binary with
+          PACMAN_EMBED_STOCK_LEVELS.
+****************************************************************************/
+static int EmbedLevels(const char *filename)
+{
+    int levelsWritten = 0;
+    if (!WriteStockLevelsHeader(filename, levelsWritten)) {
+        fprintf(stderr, "Could not write %s\n", filename);
+        return EXIT_FAILURE;
+    }
+    printf("Wrote %d levels to %s\n", levelsWritten, filename);
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[])
 {
-    system("cls");
-    CONSOLE_CURSOR_INFO info;
-    HANDLE hOutput = GetStdHandle(STD_OUTPUT_HANDLE);
-    COORD bufferSize = { 55, 31 };
-    SMALL_RECT windowDimensions = { 0,0,54,30 };
-    SetConsoleScreenBufferSize(hOutput, bufferSize);
-    SetConsoleWindowInfo(hOutput, TRUE, &windowDimensions);
-    SetConsoleTitleA(TITLE_WINDOW_TEXT);
-    HWND hWnd = FindWindow(NULL, TITLE_WINDOW_TEXT);
-
-    if (hWnd == NULL) {
-        OutputDebugString("Window was not found!\n");
-    }
-    // turn the cursor off
-    info.bVisible = FALSE;
-    info.dwSize = 1;
-    SetConsoleCursorInfo(hOutput, &info);
-
-    PacGame myGame;
-    int startTime;
-    startTime = GetTickCount();
-    
-    COORD FrameCounterPosition;
-    FrameCounterPosition.X = 18;
-    FrameCounterPosition.Y = 30;
-    
-    int frames = 0;
-    clock_t absStart = clock();
-    clock_t deltaTime = 0;
-    clock_t gameStart = 0;
-    double frameRate = 30;
-    double lowestFPS, highestFPS;
-    
-    lowestFPS = highestFPS = 0.0;
+    if (argc > 1 && strcmp(argv[1], "--compile-levels") == 0) {
+        return CompileLevels((argc > 2) ? argv[2] : LEVEL_PACK_FILENAME);
+    }
+    if (argc > 1 && strcmp(argv[1], "--embed-levels") == 0) {
+        return EmbedLevels((argc > 2) ? argv[2] : "StockLevels.h");
+    }
+    if (!LevelData::Load(1)) {
+        char levelFilename[256];
+        snprintf(levelFilename, sizeof(levelFilename), LEVEL_FILENAME_TEMPLATE, 1);
+        fprintf(stderr, "Level 1 not found in %s or %s; run the game from its own directory\n", LEVEL_PACK_FILENAME, levelFilename);
+        return EXIT_FAILURE;
+    }
+    if (argc > 1 && strcmp(argv[1], "--headless") == 0) {
+        return RunHeadless((argc > 2) ? (unsigned)strtoul(argv[2], nullptr, 10) : 1000000);
+    }
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0) {
+        return RunBench((argc > 2) ? (unsigned)strtoul(argv[2], nullptr, 10) : 200000);
+    }
+    if (argc > 1 && strcmp(argv[1], "--batch") == 0) {
+        return RunBatch(argc - 2, argv + 2);
+    }
+    if (argc > 1 && strcmp(argv[1], "--mcts-bench") == 0) {
+        return RunMctsBench((argc > 2) ? (unsigned)strtoul(argv[2], nullptr, 10) : 10000,
+                            (argc > 3) ? atoi(argv[3]) : MCTS_ITERATIONS_PER_DECISION);
+    }
+    if (argc > 2 && strcmp(argv[1], "--replay-fast") == 0) {
+        return RunReplay(argv[2], (argc > 3) ? (unsigned)strtoul(argv[3], nullptr, 10) : 1);
+    }
+
+    // [--trace [output]] [--metrics <file|unix:path> [--metrics-interval N]]
+    // [--record <replay> | --replay <replay>] [--load-state <file>] [--save-state <file>]
+    // --trace records trace spans from the start ('T' toggles recording at
+    // any time), written out on exit.  --metrics reports the Metrics
+    // counters every N seconds while the game runs.  --record saves the
+    // session's input as a replay on exit; --replay plays one back in real
+    // time instead of reading the keyboard.  --save-state writes the game
+    // as it is on exit, --load-state continues a game written that way.
+    const char *traceFilename = TRACE_FILENAME;
+    const char *metricsTarget = nullptr, *recordFilename = nullptr, *replayFilename = nullptr;
+    const char *loadStateFilename = nullptr, *saveStateFilename = nullptr;
+    int metricsInterval = METRICS_REPORT_INTERVAL_SECONDS;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--trace") == 0) {
+            TraceRecorder::SetEnabled(true);
+            if (i + 1 < argc && strncmp(argv[i + 1], "--", 2) != 0) {
+                traceFilename = argv[++i];
+            }
+        }
+        else if (strcmp(argv[i], "--metrics") == 0 && i + 1 < argc) {
+            metricsTarget = argv[++i];
+        }
+        else if (strcmp(argv[i], "--metrics-interval") == 0 && i + 1 < argc) {
+            metricsInterval = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            recordFilename = argv[++i];
+        }
+        else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replayFilename = argv[++i];
+        }
+        else if (strcmp(argv[i], "--load-state") == 0 && i + 1 < argc) {
+            loadStateFilename = argv[++i];
+        }
+        else if (strcmp(argv[i], "--save-state") == 0 && i + 1 < argc) {
+            saveStateFilename = argv[++i];
+        }
+    }
+    ReplayInput replay;
+    if (replayFilename != nullptr && !replay.Load(replayFilename)) {
+        return EXIT_FAILURE;
+    }
+    // Replays start from a new game, so they cannot begin from a saved one
+    GameSnapshot loadedState;
+    if (loadStateFilename != nullptr) {
+        if (replayFilename != nullptr || recordFilename != nullptr) {
+            fprintf(stderr, "--load-state cannot be combined with --record or --replay\n");
+            return EXIT_FAILURE;
+        }
+        if (!ReadSnapshotFile(loadStateFilename, loadedState)) {
+            fprintf(stderr, "Could not read a saved game from %s\n", loadStateFilename);
+            return EXIT_FAILURE;
+        }
+    }
+    MetricsReporter metricsReporter;
+    if (metricsTarget != nullptr && !metricsReporter.Start(metricsTarget, metricsInterval)) {
+        fprintf(stderr, "Could not report metrics to %s\n", metricsTarget);
+        return EXIT_FAILURE;
+    }
+
+    Console::Initialize(TITLE_WINDOW_TEXT);
+
+    ConsoleInput input;
+    RenderEngine renderEngine;
+    PacGame myGame(&input);
+    myGame.AttachRenderEngine(renderEngine);
+    // Every interactive game plays differently; a replay brings its seed
+    myGame.setRandomSeed((unsigned)chrono::system_clock::now().time_since_epoch().count());
+    ReplayRecorder recorder(&input, myGame.mGameMap.getCurrentLevel(), myGame.getRandomSeed());
+    if (replayFilename != nullptr) {
+        myGame.setRandomSeed(replay.getSeed());
+        myGame.setInputSource(&replay);
+        if (replay.getStartLevel() != myGame.mGameMap.getCurrentLevel()) {
+            myGame.SetStartingLevel(replay.getStartLevel());
+        }
+    }
+    else if (recordFilename != nullptr) {
+        myGame.setInputSource(&recorder);
+    }
+    if (loadStateFilename != nullptr && !myGame.RestoreSnapshot(loadedState)) {
+        Console::Shutdown();
+        fprintf(stderr, "%s does not fit the levels of this game\n", loadStateFilename);
+        return EXIT_FAILURE;
+    }
+
+    // Fixed timestep: the simulation always advances by whole ticks of
+    // MILLISECONDS_PER_TICK, however fast or slow the frames come
+    const chrono::steady_clock::duration tickDuration = chrono::milliseconds(MILLISECONDS_PER_TICK);
+    chrono::steady_clock::time_point nextTick = chrono::steady_clock::now();
+    chrono::steady_clock::time_point lastFrameStart;
+    FrameProfiler profiler;
+    unsigned controlInputBits = 0, heldInputBits = 0;
+
+    // Left alone in ATTRACT the game plays itself, as arcade cabinets do,
+    // until a key puts back the game it took over.  Never while recording
+    // or replaying, the demo is no part of the session
+    const bool demoEnabled = (replayFilename == nullptr && recordFilename == nullptr);
+    MctsInput demoInput(&myGame, (unsigned)chrono::system_clock::now().time_since_epoch().count());
+    GameSnapshot attractSnapshot;
+    bool demoRunning = false;
+    chrono::steady_clock::time_point lastActivity = chrono::steady_clock::now();
     do
     {
-        if (hWnd != GetForegroundWindow()) {
-            // Only trigger the PauseGame function if the Game State
-            // is not already PAUSED
-            if (!myGame.IsPaused()) {
-                myGame.PauseGame();
+        if (demoEnabled && !demoRunning && myGame.getGameState() == ATTRACT &&
+            chrono::steady_clock::now() - lastActivity >= chrono::milliseconds(ATTRACT_DEMO_DELAY_MILLISECONDS) &&
+            myGame.SaveSnapshot(attractSnapshot)) {
+            myGame.setInputSource(&demoInput);
+            demoRunning = true;
+        }
+
+        // A replay or demo has to run through the idle states at full
+        // speed, the keyboard plays no part in leaving them
+        if (myGame.IsIdle() && replayFilename == nullptr && !demoRunning) {
+            // Nothing to simulate until a key arrives, so sleep on the input
+            // (waking now and then to notice a lost focus) and do not try to
+            // catch up on the ticks that were slept through
+            Console::WaitForInput(IDLE_INPUT_WAIT_MILLISECONDS);
+            nextTick = chrono::steady_clock::now();
+        }
+
+        int ticksRun = 0;
+        chrono::steady_clock::time_point updateStart = chrono::steady_clock::now();
+        while (chrono::steady_clock::now() >= nextTick && ticksRun < MAX_CATCH_UP_TICKS) {
+            myGame.Step();
+            nextTick += tickDuration;
+            ticksRun++;
+
+            // The keyboard still controls the program during a replay or
+            // demo.  Toggle on the press, not for as long as the key is held
+            controlInputBits = (replayFilename != nullptr || demoRunning) ? input.PollInput(myGame.getGameTicks()) : myGame.lastInputBits;
+            unsigned pressedInputBits = controlInputBits & ~heldInputBits;
+            heldInputBits = controlInputBits;
+            if (pressedInputBits & INPUT_PROFILER_BIT) {
+                profiler.ToggleOverlay();
+            }
+            if (pressedInputBits & INPUT_TRACE_BIT) {
+                TraceRecorder::SetEnabled(!TraceRecorder::IsEnabled());
+            }
+            if (demoRunning && (controlInputBits & ~(INPUT_PROFILER_BIT | INPUT_TRACE_BIT)) != 0) {
+                myGame.RestoreSnapshot(attractSnapshot);
+                myGame.setInputSource(&input);
+                demoRunning = false;
+            }
+            // A window in the background (INPUT_FOCUS_LOST_BIT) counts too,
+            // nobody is watching a demo there
+            if (controlInputBits != 0 || myGame.getGameState() != ATTRACT) {
+                lastActivity = chrono::steady_clock::now();
             }
         }
-        myGame.GatherGamePlayInput();
-        if (clock() - gameStart >= MILLISECONDS_FPS_THRESHOLD)
-        {
-            double timeStep = (double)(clock() - gameStart);
-            myGame.Update(timeStep);
-            myGame.Render();
-            gameStart = clock();
+        if (ticksRun == MAX_CATCH_UP_TICKS && chrono::steady_clock::now() >= nextTick) {
+            // Too far behind (debugger, suspended terminal): drop the backlog
+            // instead of fast-forwarding through it
+            nextTick = chrono::steady_clock::now() + tickDuration;
+        }
 
-            clock_t end = clock();
-            frames++;
+        if (ticksRun > 0) {
+            chrono::steady_clock::time_point renderStart = chrono::steady_clock::now();
+            myGame.Render();
+            profiler.DrawOverlay(renderEngine, DEFAULT_MAP_WIDTH + SCREEN_OFFSET_MARGIN * 2, PROFILER_OVERLAY_HEIGHT_POSITION);
+            chrono::steady_clock::time_point presentStart = chrono::steady_clock::now();
+            renderEngine.Present();
+            chrono::steady_clock::time_point frameEnd = chrono::steady_clock::now();
 
-            if (end - absStart > CLOCKS_PER_SEC && frames > 10) {
-                double fps = (double)frames / ((end - absStart) / CLOCKS_PER_SEC);
-                SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), FrameCounterPosition);
-                absStart = end;
-                frames = 0;
-                cout << "FPS: " << fps;
+            profiler.Record(PHASE_UPDATE, renderStart - updateStart);
+            profiler.Record(PHASE_RENDER, presentStart - renderStart);
+            profiler.Record(PHASE_PRESENT, frameEnd - presentStart);
+            // Start to start, so the time slept between frames counts too
+            if (lastFrameStart != chrono::steady_clock::time_point()) {
+                profiler.Record(PHASE_FRAME, updateStart - lastFrameStart);
             }
+            lastFrameStart = updateStart;
         }
-    } while (!GetAsyncKeyState(VK_ESCAPE));
+        Console::SleepUntil(nextTick);
+    } while (!(controlInputBits & INPUT_QUIT_BIT) && !(replayFilename != nullptr && myGame.getGameTicks() >= replay.getTickCount()));
     // GAME END
     myGame.RenderStatusText(GAMEOVER_TEXT);
-    SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), FrameCounterPosition);
+    myGame.Render();
+    renderEngine.Present();
+    Console::Shutdown();
+    if (!profiler.WriteReport(FRAME_PROFILE_FILENAME)) {
+        fprintf(stderr, "Could not write %s\n", FRAME_PROFILE_FILENAME);
+    }
+    metricsReporter.Stop();
+    if (recordFilename != nullptr && !recorder.Save(recordFilename)) {
+        fprintf(stderr, "Could not write %s\n", recordFilename);
+    }
+    GameSnapshot savedState;
+    if (saveStateFilename != nullptr && (!myGame.SaveSnapshot(savedState) || !WriteSnapshotFile(saveStateFilename, savedState))) {
+        fprintf(stderr, "Could not write %s\n", saveStateFilename);
+    }
+    TraceRecorder::SetEnabled(false);
+    if (TraceRecorder::getEventCount() > 0 && !TraceRecorder::WriteChromeTrace(traceFilename)) {
+        fprintf(stderr, "Could not write %s\n", traceFilename);
+    }
+#ifdef _WIN32
     system("PAUSE");
+#endif
     return EXIT_SUCCESS;
-}
\ No newline at end of file
+}
@@ -0,0 +1,357 @@
+/****************************************************************************
+File: MctsInput.cpp
+Author: fookenCode
+****************************************************************************/
+#include "MctsInput.h"
+#include "Bitboard.h"
+#include "TraceRecorder.h"
+#include <chrono>
+#include <cmath>
+
+// Each search looks this far ahead, about a dozen tiles
+const static int MCTS_SEARCH_HORIZON_TICKS = 96;
+// A move is held until the Player reaches the next tile, or gives up after this
+const static int MCTS_ACTION_TICK_LIMIT = 16;
+// Pellets further away than this all look the same
+const static int MCTS_DISTANCE_HORIZON = 32;
+// Points worth a full score for progress; 20 pellets or one Ghost
+const static double MCTS_SCORE_SCALE = 200.0;
+// UCB1 exploration weight, for values between 0 and 1
+const static double MCTS_EXPLORATION = 0.7;
+// What a rollout is worth: dying is worth nothing, surviving the horizon a
+// fixed part, and the rest is split between points and pellets nearby
+const static double MCTS_SURVIVAL_VALUE = 0.4;
+const static double MCTS_SCORE_VALUE = 0.5;
+const static double MCTS_DISTANCE_VALUE = 0.1;
+
+const static int X_OFFSETS[MAX_DIRECTION] = { -1, 0, 1, 0 };
+const static int Y_OFFSETS[MAX_DIRECTION] = { 0, -1, 0, 1 };
+
+/****************************************************************************
+Function: PickDirection
+Parameter(s): Random & - Generator to draw from
+              unsigned - DIRECTION_BITS to choose between, at least one set
+Output: int - One of the directions, each equally likely.
+Comments: N/A
+****************************************************************************/
+static int PickDirection(Random &random, unsigned directionBits) {
+    unsigned pick = random.NextBelow((unsigned)PopCount(directionBits));
+    for (int direction = 0; direction < MAX_DIRECTION; ++direction) {
+        if ((directionBits & (LEFT_BIT << direction)) && pick-- == 0) {
+            return direction;
+        }
+    }
+    return MAX_DIRECTION;
+} // END PickDirection
+
+MctsInput::MctsInput(PacGame *game, unsigned seed, int iterationsPerDecision) :
+    mGame(game), mRandom(seed), mIterationsPerDecision(iterationsPerDecision > 0 ? iterationsPerDecision : 1),
+    mRolloutGame(&mRolloutInput, true), mRootTickPending(false), mRootLevel(0), mRootLives(0), mRootScore(0),
+    mNodes(mIterationsPerDecision + 1), mNodeCount(0), mLastXPos(-1), mLastYPos(-1), mHeldDirectionBit(0),
+    mDecisionCount(0), mRolloutCount(0), mRolloutTicks(0) {
+}
+
+/****************************************************************************
+Function: AddNode
+Parameter(s): int - Index of the parent Node, or -1 for the root
+Output: int - Index of the new Node.
+Comments: Callers check there is room first.
+****************************************************************************/
+int MctsInput::AddNode(int parent) {
+    Node &node = mNodes[mNodeCount];
+    node.parent = parent;
+    for (int direction = 0; direction < MAX_DIRECTION; ++direction) {
+        node.children[direction] = -1;
+    }
+    node.visits = 0;
+    node.totalValue = 0.0;
+    return mNodeCount++;
+} // END AddNode
+
+/****************************************************************************
+Function: ComputePelletDistances
+Parameter(s): N/A
+Output: N/A
+Comments: Breadth first search out from every pellet still on the Map, so
+          a rollout that ends with nothing eaten still scores better the
+          closer it got to the next pellet.  Run once per decision.
+****************************************************************************/
+void MctsInput::ComputePelletDistances() {
+    GameMap &map = mGame->mGameMap;
+    const int width = map.getMapWidth();
+    const int height = map.getMapHeight();
+    const Bitboard &pellets = map.getPelletBoard();
+    const Bitboard &powerPellets = map.getPowerPelletBoard();
+
+    mPelletDistance.assign(width * height, -1);
+    mSearchQueue.resize(width * height);
+    int head = 0, tail = 0;
+    for (int i = 0; i < width * height; ++i) {
+        if (pellets.Test(i) || powerPellets.Test(i)) {
+            mPelletDistance[i] = 0;
+            mSearchQueue[tail++] = i;
+        }
+    }
+
+    while (head < tail) {
+        const int index = mSearchQueue[head++];
+        const int xPos = index % width, yPos = index / width;
+        const unsigned validDirections = map.getAvailableDirectionsForPosition(xPos, yPos);
+        for (int direction = 0; direction < MAX_DIRECTION; ++direction) {
+            const int nextX = xPos + X_OFFSETS[direction], nextY = yPos + Y_OFFSETS[direction];
+            if (!(validDirections & (LEFT_BIT << direction)) || nextX < 0 || nextX >= width || nextY < 0 || nextY >= height) {
+                continue;
+            }
+            const int next = map.getBoardIndex(nextX, nextY);
+            if (mPelletDistance[next] < 0) {
+                mPelletDistance[next] = mPelletDistance[index] + 1;
+                mSearchQueue[tail++] = next;
+            }
+        }
+    }
+} // END ComputePelletDistances
+
+/****************************************************************************
+Function: AdvanceRollout
+Parameter(s): unsigned - GAME_INPUTS bits held for the tick
+Output: N/A
+Comments: Steps the copy by one tick.  The root snapshot is taken inside
+          the real game's Step(), after its clock has moved on but before
+          the input is applied, so the first tick of every iteration only
+          calls FinishStep().
+****************************************************************************/
+void MctsInput::AdvanceRollout(unsigned inputBits) {
+    mRolloutInput.heldBits = inputBits;
+    if (mRootTickPending) {
+        mRolloutGame.FinishStep(inputBits);
+        mRootTickPending = false;
+    }
+    else {
+        mRolloutGame.Step();
+    }
+    mRolloutTicks++;
+} // END AdvanceRollout
+
+/****************************************************************************
+Function: IsRolloutOver
+Parameter(s): int - Ticks played since the root
+Output: bool - True at the horizon, or once the Player died or cleared the
+               level.
+Comments: N/A
+****************************************************************************/
+bool MctsInput::IsRolloutOver(int ticksPlayed) {
+    return (ticksPlayed >= MCTS_SEARCH_HORIZON_TICKS || mRolloutGame.getGameState() != RUNNING);
+} // END IsRolloutOver
+
+/****************************************************************************
+Function: PlayDirection
+Parameter(s): int - Direction to hold, MAX_DIRECTION for none
+              int - Ticks played since the root
+Output: int - Ticks played since the root afterwards.
+Comments: Holds the direction in the copy until the Player reaches another
+          tile, the same as PollInput() does in the real game.
+****************************************************************************/
+int MctsInput::PlayDirection(int direction, int ticksPlayed) {
+    PlayerEntity &player = mRolloutGame.mPlayer;
+    const int xPos = (int)player.getXPosition(), yPos = (int)player.getYPosition();
+    const unsigned inputBits = (direction < MAX_DIRECTION) ? (LEFT_BIT << direction) : 0;
+
+    for (int i = 0; i < MCTS_ACTION_TICK_LIMIT && !IsRolloutOver(ticksPlayed); ++i) {
+        AdvanceRollout(inputBits);
+        ticksPlayed++;
+        if ((int)player.getXPosition() != xPos || (int)player.getYPosition() != yPos) {
+            break;
+        }
+    }
+    return ticksPlayed;
+} // END PlayDirection
+
+/****************************************************************************
+Function: SelectChild
+Parameter(s): const Node & - Node whose valid directions all have children
+              unsigned - DIRECTION_BITS the Player may take from it
+Output: int - Direction with the highest UCB1 score, or -1 if there is none.
+Comments: N/A
+****************************************************************************/
+int MctsInput::SelectChild(const Node &node, unsigned validDirections) {
+    const double logVisits = std::log((double)(node.visits > 0 ? node.visits : 1));
+    int bestDirection = -1;
+    double bestScore = 0.0;
+    for (int direction = 0; direction < MAX_DIRECTION; ++direction) {
+        if (!(validDirections & (LEFT_BIT << direction)) || node.children[direction] < 0) {
+            continue;
+        }
+        const Node &child = mNodes[node.children[direction]];
+        if (child.visits == 0) {
+            return direction;
+        }
+        double score = child.totalValue / child.visits + MCTS_EXPLORATION * std::sqrt(logVisits / child.visits);
+        if (bestDirection < 0 || score > bestScore) {
+            bestDirection = direction;
+            bestScore = score;
+        }
+    }
+    return bestDirection;
+} // END SelectChild
+
+/****************************************************************************
+Function: EvaluateRollout
+Parameter(s): N/A
+Output: double - Value between 0 and 1 of where the copy ended up.
+Comments: N/A
+****************************************************************************/
+double MctsInput::EvaluateRollout() {
+    if (mRolloutGame.mLivesBoard.getLivesLeft() < mRootLives) {
+        return 0.0;
+    }
+    if (mRolloutGame.getGameState() == NEXT_LEVEL) {
+        return 1.0;
+    }
+
+    double scoreGained = (mRolloutGame.mScoreBoard.getScoreTotal() - mRootScore) / MCTS_SCORE_SCALE;
+    if (scoreGained > 1.0) {
+        scoreGained = 1.0;
+    }
+
+    GameMap &map = mRolloutGame.mGameMap;
+    const int xPos = (int)mRolloutGame.mPlayer.getXPosition(), yPos = (int)mRolloutGame.mPlayer.getYPosition();
+    int distance = MCTS_DISTANCE_HORIZON;
+    if (xPos >= 0 && xPos < map.getMapWidth() && yPos >= 0 && yPos < map.getMapHeight()) {
+        int steps = mPelletDistance[map.getBoardIndex(xPos, yPos)];
+        if (steps >= 0 && steps < distance) {
+            distance = steps;
+        }
+    }
+
+    return MCTS_SURVIVAL_VALUE + MCTS_SCORE_VALUE * scoreGained +
+           MCTS_DISTANCE_VALUE * (MCTS_DISTANCE_HORIZON - distance) / MCTS_DISTANCE_HORIZON;
+} // END EvaluateRollout
+
+/****************************************************************************
+Function: Search
+Parameter(s): N/A
+Output: int - Direction to take from the Player's tile, or -1 if there is
+              no choice to make.
+Comments: Open loop: the tree holds directions only, every iteration plays
+          them again from the root.  The game is deterministic for a
+          given input, so each Node always stands for the same state.
+****************************************************************************/
+int MctsInput::Search() {
+    TRACE_SCOPE("MctsInput::Search");
+    if (!mGame->SaveSnapshot(mRoot)) {
+        return -1;
+    }
+    mRootLevel = mRoot.level;
+    mRootLives = mRoot.livesLeft;
+    mRootScore = (long)mRoot.score;
+    ComputePelletDistances();
+
+    mNodeCount = 0;
+    AddNode(-1);
+    PlayerEntity &player = mRolloutGame.mPlayer;
+    GameMap &map = mRolloutGame.mGameMap;
+
+    for (int iteration = 0; iteration < mIterationsPerDecision; ++iteration) {
+        mRolloutGame.RestoreSnapshot(mRoot);
+        mRootTickPending = true;
+        int node = 0, ticksPlayed = 0;
+
+        // Selection down the tree, then expansion of one untried direction
+        while (!IsRolloutOver(ticksPlayed)) {
+            const unsigned validDirections = map.getAvailableDirectionsForPosition((int)player.getXPosition(), (int)player.getYPosition());
+            unsigned untriedDirections = 0;
+            for (int direction = 0; direction < MAX_DIRECTION; ++direction) {
+                if ((validDirections & (LEFT_BIT << direction)) && mNodes[node].children[direction] < 0) {
+                    untriedDirections |= LEFT_BIT << direction;
+                }
+            }
+
+            if (untriedDirections != 0 && mNodeCount < (int)mNodes.size()) {
+                int direction = PickDirection(mRandom, untriedDirections);
+                int child = AddNode(node);
+                mNodes[node].children[direction] = child;
+                node = child;
+                ticksPlayed = PlayDirection(direction, ticksPlayed);
+                break;
+            }
+
+            int direction = SelectChild(mNodes[node], validDirections);
+            if (direction < 0) {
+                break;
+            }
+            node = mNodes[node].children[direction];
+            ticksPlayed = PlayDirection(direction, ticksPlayed);
+        }
+
+        // Rollout: random turns at every tile, only turning back at dead ends
+        while (!IsRolloutOver(ticksPlayed)) {
+            const unsigned validDirections = map.getAvailableDirectionsForPosition((int)player.getXPosition(), (int)player.getYPosition());
+            const int movementDirection = player.getMovementDirection();
+            unsigned choices = validDirections;
+            if (movementDirection < MAX_DIRECTION) {
+                unsigned reverseBit = LEFT_BIT << ((movementDirection + 2) % MAX_DIRECTION);
+                if ((choices & ~reverseBit) != 0) {
+                    choices &= ~reverseBit;
+                }
+            }
+
+            int direction = (choices != 0) ? PickDirection(mRandom, choices) : MAX_DIRECTION;
+            ticksPlayed = PlayDirection(direction, ticksPlayed);
+        }
+
+        const double value = EvaluateRollout();
+        for (int n = node; n >= 0; n = mNodes[n].parent) {
+            mNodes[n].visits++;
+            mNodes[n].totalValue += value;
+        }
+        if (mRolloutGame.getGameState() == NEXT_LEVEL) {
+            // Update() has moved the level number on, the tiles are still the root's
+            map.setCurrentLevel(mRootLevel);
+        }
+        mRolloutCount++;
+    }
+
+    // The most visited first move is the one the search trusts most
+    const Node &root = mNodes[0];
+    int bestDirection = -1;
+    for (int direction = 0; direction < MAX_DIRECTION; ++direction) {
+        int child = root.children[direction];
+        if (child >= 0 && (bestDirection < 0 || mNodes[child].visits > mNodes[root.children[bestDirection]].visits)) {
+            bestDirection = direction;
+        }
+    }
+    return bestDirection;
+} // END Search
+
+/****************************************************************************
+Function: PollInput
+Parameter(s): unsigned - Simulation tick the input is sampled for.
+Output: unsigned - GAME_INPUTS bits pressed for this tick.
+Comments: Inserts a coin and presses Start whenever no game is running,
+          and searches again every time the Player reaches a new tile.
+****************************************************************************/
+unsigned MctsInput::PollInput(unsigned tick) {
+    if (mGame->getGameState() != RUNNING) {
+        mHeldDirectionBit = 0;
+        // Only a fresh press of the coin counts, so it is let go every other tick
+        unsigned inputBits = INPUT_START_BIT;
+        if (mGame->getGameState() == ATTRACT && !mGame->HasCredits() && (tick & 1)) {
+            inputBits |= INPUT_COIN_BIT;
+        }
+        return inputBits;
+    }
+
+    int xPos = (int)mGame->mPlayer.getXPosition();
+    int yPos = (int)mGame->mPlayer.getYPosition();
+    if (xPos != mLastXPos || yPos != mLastYPos || mHeldDirectionBit == 0) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        int direction = Search();
+        mDecisionLatency.Record((unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+        mDecisionCount++;
+
+        mHeldDirectionBit = (direction >= 0) ? (LEFT_BIT << direction) : 0;
+        mLastXPos = xPos;
+        mLastYPos = yPos;
+    }
+    return mHeldDirectionBit;
+} // END PollInput
@@ -0,0 +1,85 @@
+/****************************************************************************
+File: MctsInput.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _MCTS_INPUT_H_
+#define _MCTS_INPUT_H_
+
+#include "FrameProfiler.h"
+#include "GameSnapshot.h"
+#include "InputSource.h"
+#include "PacGame.h"
+#include "Random.h"
+#include <vector>
+
+/****************************************************************************
+Class: MctsInput
+Comments: Player that looks ahead.  Every time the Player reaches a new tile
+          the game is snapshotted and a Monte Carlo tree search is run on a
+          private headless copy of it: each iteration restores the copy,
+          walks the tree of directions taken at the tiles ahead (UCB1), adds
+          one new direction, then plays random directions up to the search
+          horizon and scores how it went.  The direction of the most
+          visited first move is held until the next tile.
+          Runs a fixed number of iterations per decision, so a game is
+          fully determined by the seeds, and keeps the rollout and latency
+          counts that make it a benchmark of cloning and stepping the game.
+****************************************************************************/
+class MctsInput : public InputSource {
+private:
+    // Whatever the current iteration wants pressed in the copy
+    class HeldInput : public InputSource {
+    public:
+        unsigned heldBits;
+        HeldInput() : heldBits(0) { }
+        virtual unsigned PollInput(unsigned /*tick*/) { return heldBits; }
+    };
+
+    struct Node {
+        int parent, children[MAX_DIRECTION];
+        unsigned visits;
+        double totalValue;
+    };
+
+    PacGame *mGame;
+    Random mRandom;
+    int mIterationsPerDecision;
+
+    HeldInput mRolloutInput;
+    PacGame mRolloutGame;
+    GameSnapshot mRoot;
+    bool mRootTickPending;
+    int mRootLevel, mRootLives;
+    long mRootScore;
+
+    // Nodes of the current search; sized once, nothing is allocated per decision
+    std::vector<Node> mNodes;
+    int mNodeCount;
+    // Steps from every tile to the nearest pellet at the root
+    std::vector<int> mPelletDistance, mSearchQueue;
+
+    int mLastXPos, mLastYPos;
+    unsigned mHeldDirectionBit;
+
+    unsigned long long mDecisionCount, mRolloutCount, mRolloutTicks;
+    LatencyHistogram mDecisionLatency;
+
+    int AddNode(int parent);
+    void ComputePelletDistances();
+    void AdvanceRollout(unsigned inputBits);
+    bool IsRolloutOver(int ticksPlayed);
+    int PlayDirection(int direction, int ticksPlayed);
+    int SelectChild(const Node &node, unsigned validDirections);
+    double EvaluateRollout();
+    int Search();
+public:
+    MctsInput(PacGame *game, unsigned seed = 1, int iterationsPerDecision = MCTS_ITERATIONS_PER_DECISION);
+    virtual unsigned PollInput(unsigned tick);
+
+    unsigned long long getDecisionCount() const { return mDecisionCount; }
+    unsigned long long getRolloutCount() const { return mRolloutCount; }
+    unsigned long long getRolloutTicks() const { return mRolloutTicks; }
+    // Nanoseconds taken by each search
+    const LatencyHistogram &getDecisionLatency() const { return mDecisionLatency; }
+};
+#endif // _MCTS_INPUT_H_
@@ -0,0 +1,240 @@
+/****************************************************************************
+File: Metrics.cpp
+Author: fookenCode
+****************************************************************************/
+#include "Metrics.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+Metrics::CounterShard Metrics::sShards[Metrics::COUNTER_SHARDS];
+Metrics::GaugeLine Metrics::sGauges;
+std::atomic<int> Metrics::sNextShard(0);
+
+const static char *COUNTER_NAMES[MAX_COUNTERS] = { "simulation_ticks", "pellets_consumed", "ghost_decisions", "level_loads",
+                                                   "full_redraws", "frames_presented", "render_cells", "render_bytes" };
+const static char *GAUGE_NAMES[MAX_GAUGES] = { "frame_cells", "frame_bytes" };
+const static char *UNIX_SOCKET_PREFIX = "unix:";
+
+/****************************************************************************
+Function: TakeSnapshot
+Parameter(s): Snapshot & - Receives the current values
+Output: N/A
+Comments: Each value is read atomically, but the set as a whole is not a
+          single instant; counters still moving may be a few updates apart.
+****************************************************************************/
+void Metrics::TakeSnapshot(Snapshot &snapshot) {
+    for (int counter = 0; counter < MAX_COUNTERS; ++counter) {
+        unsigned long long total = 0;
+        for (int shard = 0; shard < COUNTER_SHARDS; ++shard) {
+            total += sShards[shard].counters[counter].load(std::memory_order_relaxed);
+        }
+        snapshot.counters[counter] = total;
+    }
+    for (int gauge = 0; gauge < MAX_GAUGES; ++gauge) {
+        snapshot.gauges[gauge] = sGauges.gauges[gauge].load(std::memory_order_relaxed);
+    }
+} // END TakeSnapshot
+
+/****************************************************************************
+Function: getCounterName
+Parameter(s): int - METRIC_COUNTERS value
+Output: const char * - Name used in the reports.
+Comments: N/A
+****************************************************************************/
+const char *Metrics::getCounterName(int counter) {
+    return COUNTER_NAMES[counter];
+} // END getCounterName
+
+/****************************************************************************
+Function: getGaugeName
+Parameter(s): int - METRIC_GAUGES value
+Output: const char * - Name used in the reports.
+Comments: N/A
+****************************************************************************/
+const char *Metrics::getGaugeName(int gauge) {
+    return GAUGE_NAMES[gauge];
+} // END getGaugeName
+
+/****************************************************************************
+Function: FormatSnapshot
+Parameter(s): const Metrics::Snapshot & - Values to format
+              double - Seconds since reporting started
+              char * - Receives the line
+              int - Size of the buffer
+Output: int - Length of the line.
+Comments: "uptime=12.0 simulation_ticks=750 ... frame_bytes=42\n"
+****************************************************************************/
+int MetricsReporter::FormatSnapshot(const Metrics::Snapshot &snapshot, double uptimeSeconds, char *text, int textSize) {
+    int length = snprintf(text, textSize, "uptime=%.1f", uptimeSeconds);
+    for (int counter = 0; counter < MAX_COUNTERS && length < textSize; ++counter) {
+        length += snprintf(text + length, textSize - length, " %s=%llu", Metrics::getCounterName(counter), snapshot.counters[counter]);
+    }
+    for (int gauge = 0; gauge < MAX_GAUGES && length < textSize; ++gauge) {
+        length += snprintf(text + length, textSize - length, " %s=%lld", Metrics::getGaugeName(gauge), snapshot.gauges[gauge]);
+    }
+    if (length < textSize) {
+        length += snprintf(text + length, textSize - length, "\n");
+    }
+    return (length < textSize) ? length : textSize - 1;
+} // END FormatSnapshot
+
+/****************************************************************************
+Function: Start
+Parameter(s): const char * - File path, or "unix:<socket path>"
+              int - Seconds between snapshots
+Output: bool - Whether the reporter is running.
+Comments: A file that cannot be opened fails straight away; a socket that
+          is not listening yet is simply retried on every snapshot.
+****************************************************************************/
+bool MetricsReporter::Start(const char *target, int intervalSeconds) {
+    if (mThread.joinable() || intervalSeconds <= 0) {
+        return false;
+    }
+    const bool isSocket = strncmp(target, UNIX_SOCKET_PREFIX, strlen(UNIX_SOCKET_PREFIX)) == 0;
+#ifdef _WIN32
+    if (isSocket) {
+        return false;
+    }
+#endif
+    if (!isSocket) {
+        FILE *output = fopen(target, "a");
+        if (output == nullptr) {
+            return false;
+        }
+        fclose(output);
+    }
+    mStopping = false;
+    mThread = std::thread(&MetricsReporter::Run, this, std::string(target), intervalSeconds);
+    return true;
+} // END Start
+
+/****************************************************************************
+Function: Stop
+Parameter(s): N/A
+Output: N/A
+Comments: Wakes the reporter, which writes its final snapshot and exits.
+****************************************************************************/
+void MetricsReporter::Stop() {
+    if (!mThread.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mWake.notify_one();
+    mThread.join();
+} // END Stop
+
+/****************************************************************************
+Function: Run
+Parameter(s): std::string - Target given to Start
+              int - Seconds between snapshots
+Output: N/A
+Comments: Body of the reporter thread.
+****************************************************************************/
+void MetricsReporter::Run(std::string target, int intervalSeconds) {
+    const bool isSocket = target.compare(0, strlen(UNIX_SOCKET_PREFIX), UNIX_SOCKET_PREFIX) == 0;
+    const std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point nextReport = started;
+    int socketHandle = -1;
+    bool stopping = false;
+    while (!stopping) {
+        nextReport += std::chrono::seconds(intervalSeconds);
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mWake.wait_until(lock, nextReport, [this] { return mStopping; });
+            stopping = mStopping;
+        }
+
+        Metrics::Snapshot snapshot;
+        Metrics::TakeSnapshot(snapshot);
+        char text[512];
+        FormatSnapshot(snapshot, std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count(), text, sizeof(text));
+        if (isSocket) {
+            WriteToSocket(target.substr(strlen(UNIX_SOCKET_PREFIX)), socketHandle, text);
+        }
+        else {
+            WriteToFile(target, text);
+        }
+    }
+#ifndef _WIN32
+    if (socketHandle >= 0) {
+        close(socketHandle);
+    }
+#endif
+} // END Run
+
+/****************************************************************************
+Function: WriteToFile
+Parameter(s): const std::string & - File to append to
+              const char * - Line to write
+Output: bool - Whether the line was written.
+Comments: Opened per snapshot, so the file can be rotated underneath.
+****************************************************************************/
+bool MetricsReporter::WriteToFile(const std::string &filename, const char *text) {
+    FILE *output = fopen(filename.c_str(), "a");
+    if (output == nullptr) {
+        return false;
+    }
+    fputs(text, output);
+    return fclose(output) == 0;
+} // END WriteToFile
+
+/****************************************************************************
+Function: WriteToSocket
+Parameter(s): const std::string & - Path of the Unix socket
+              int & - Connected socket, -1 when there is none
+              const char * - Line to write
+Output: bool - Whether the line was sent.
+Comments: Connects when not connected; on a failed send the connection is
+          dropped and the next snapshot tries again.
+****************************************************************************/
+bool MetricsReporter::WriteToSocket(const std::string &path, int &socketHandle, const char *text) {
+#ifdef _WIN32
+    return false;
+#else
+    if (socketHandle < 0) {
+        struct sockaddr_un address;
+        memset(&address, 0, sizeof(address));
+        if (path.size() >= sizeof(address.sun_path)) {
+            return false;
+        }
+        address.sun_family = AF_UNIX;
+        memcpy(address.sun_path, path.c_str(), path.size());
+
+        socketHandle = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socketHandle < 0) {
+            return false;
+        }
+#ifdef SO_NOSIGPIPE
+        int noSignal = 1;
+        setsockopt(socketHandle, SOL_SOCKET, SO_NOSIGPIPE, &noSignal, sizeof(noSignal));
+#endif
+        if (connect(socketHandle, (struct sockaddr *)&address, sizeof(address)) != 0) {
+            close(socketHandle);
+            socketHandle = -1;
+            return false;
+        }
+    }
+
+#ifdef MSG_NOSIGNAL
+    const int sendFlags = MSG_NOSIGNAL;
+#else
+    const int sendFlags = 0;
+#endif
+    size_t length = strlen(text);
+    if (send(socketHandle, text, length, sendFlags) != (ssize_t)length) {
+        close(socketHandle);
+        socketHandle = -1;
+        return false;
+    }
+    return true;
+#endif
+} // END WriteToSocket
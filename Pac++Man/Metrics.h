@@ -0,0 +1,95 @@
+/****************************************************************************
+File: Metrics.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _METRICS_H_
+#define _METRICS_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// Running totals since start-up
+enum METRIC_COUNTERS { COUNTER_SIMULATION_TICKS = 0, COUNTER_PELLETS_CONSUMED, COUNTER_GHOST_DECISIONS, COUNTER_LEVEL_LOADS,
+                       COUNTER_FULL_REDRAWS, COUNTER_FRAMES_PRESENTED, COUNTER_RENDER_CELLS, COUNTER_RENDER_BYTES, MAX_COUNTERS };
+// Latest value written
+enum METRIC_GAUGES { GAUGE_FRAME_CELLS = 0, GAUGE_FRAME_BYTES, MAX_GAUGES };
+
+/****************************************************************************
+Class: Metrics
+Comments: Process wide counters and gauges the hot paths update with
+          relaxed atomics, never a lock.  Counters are sharded: each thread
+          adds into one of COUNTER_SHARDS cache lines holding every counter,
+          so batch workers bumping the same counter do not fight over it;
+          a snapshot sums the shards.  Gauges are meant to have a single
+          writer (the thread presenting frames).
+****************************************************************************/
+class Metrics {
+public:
+    const static int COUNTER_SHARDS = 8;
+    const static int CACHE_LINE_BYTES = 64;
+
+    struct Snapshot {
+        unsigned long long counters[MAX_COUNTERS];
+        long long gauges[MAX_GAUGES];
+    };
+private:
+    struct alignas(CACHE_LINE_BYTES) CounterShard {
+        std::atomic<unsigned long long> counters[MAX_COUNTERS];
+    };
+    struct alignas(CACHE_LINE_BYTES) GaugeLine {
+        std::atomic<long long> gauges[MAX_GAUGES];
+    };
+    static CounterShard sShards[COUNTER_SHARDS];
+    static GaugeLine sGauges;
+    static std::atomic<int> sNextShard;
+
+    static int ShardIndex() {
+        static thread_local int shard = sNextShard.fetch_add(1, std::memory_order_relaxed) % COUNTER_SHARDS;
+        return shard;
+    }
+public:
+    static void Increment(int counter, unsigned long long amount = 1) {
+        sShards[ShardIndex()].counters[counter].fetch_add(amount, std::memory_order_relaxed);
+    }
+    static void SetGauge(int gauge, long long value) {
+        sGauges.gauges[gauge].store(value, std::memory_order_relaxed);
+    }
+
+    static void TakeSnapshot(Snapshot &snapshot);
+    static const char *getCounterName(int counter);
+    static const char *getGaugeName(int gauge);
+};
+
+/****************************************************************************
+Class: MetricsReporter
+Comments: Background thread writing a Metrics snapshot every interval, one
+          line of name=value pairs per snapshot, to either a file (appended
+          to) or, given "unix:<path>", a listening Unix stream socket (the
+          connection is re-made if it drops).  Stopping writes one final
+          snapshot.
+****************************************************************************/
+class MetricsReporter {
+private:
+    std::thread mThread;
+    std::mutex mMutex;
+    std::condition_variable mWake;
+    bool mStopping;
+    MetricsReporter(const MetricsReporter &other);
+    MetricsReporter &operator=(const MetricsReporter &other);
+
+    void Run(std::string target, int intervalSeconds);
+    static bool WriteToFile(const std::string &filename, const char *text);
+    static bool WriteToSocket(const std::string &path, int &socketHandle, const char *text);
+public:
+    MetricsReporter() : mStopping(false) { }
+    ~MetricsReporter() { Stop(); }
+
+    static int FormatSnapshot(const Metrics::Snapshot &snapshot, double uptimeSeconds, char *text, int textSize);
+
+    bool Start(const char *target, int intervalSeconds);
+    void Stop();
+};
+#endif // _METRICS_H_
@@ -3,6 +3,7 @@
 
 #include "Entity.h"
 #include "Constants.h"
+#include "GameSnapshot.h"
 
 class MovingEntity : public Entity {
 protected:
@@ -21,9 +22,21 @@ public:
     void setMaxValidWidth(int newWidth) { maxValidWidth = newWidth; }
     void setMaxValidHeight(int newHeight) { maxValidHeight = newHeight; }
 
+    void SaveMovement(EntitySnapshot &snapshot) {
+        snapshot.xPos = xPos;
+        snapshot.yPos = yPos;
+        snapshot.movementSpeed = movementSpeed;
+        snapshot.movementDirection = movementDirection;
+    }
+    void RestoreMovement(const EntitySnapshot &snapshot) {
+        setPosition(snapshot.xPos, snapshot.yPos);
+        movementSpeed = snapshot.movementSpeed;
+        movementDirection = snapshot.movementDirection;
+    }
+
     virtual void Update(unsigned validDirections, double timeStep) = 0;
     virtual void Move(double timeStep) = 0;
-    virtual void Render() = 0;
+    virtual void Render(RenderEngine &engine) = 0;
     virtual void Reset() = 0;
 };
 
@@ -1,13 +1,53 @@
 #include "PacGame.h"
+#include "Metrics.h"
+#include "TileClass.h"
+#include "TraceRecorder.h"
+#include <cstring>
+
+// Indexed by SNAPSHOT_STATUS_TEXTS, up to STATUS_LEVEL
+const static char *SNAPSHOT_STATUS_TEXT_TABLE[] = { CLEAR_STATUS_TEXT, PRESS_START_TEXT, READY_TEXT, PAUSED_TEXT, GAMEOVER_TEXT };
+
+/****************************************************************************
+Function: Step
+Parameter(s): N/A
+Output: N/A
+Comments: Advances the simulation by exactly one tick.  Samples the injected
+          InputSource, runs the game state machine and updates all
+          entities.  Produces no console output, so it can be driven as
+          fast as the CPU allows when the game is headless.
+****************************************************************************/
+void PacGame::Step()
+{
+    TRACE_SCOPE("PacGame::Step");
+    gameTicks++;
+    gameTime += MILLISECONDS_PER_TICK;
+    Metrics::Increment(COUNTER_SIMULATION_TICKS);
+    FinishStep(mInputSource->PollInput(gameTicks));
+} // END Step
+
+/****************************************************************************
+Function: FinishStep
+Parameter(s): unsigned - GAME_INPUTS bits for the tick
+Output: N/A
+Comments: The rest of Step() once the clock has moved on and the input is
+          known.  Lets a snapshot taken while the InputSource is polled
+          finish that tick with other input.
+****************************************************************************/
+void PacGame::FinishStep(unsigned inputBits)
+{
+    GatherGamePlayInput(inputBits);
+    Update();
+} // END FinishStep
 
 /****************************************************************************
 Function: Reset
 Parameter(s): N/A
 Output: N/A
-Comments: Reset Game States and re-render all objects to screen
+Comments: Reset Game States and flag all objects to be re-rendered
 ****************************************************************************/
 void PacGame::Reset()
 {
+    TRACE_SCOPE("PacGame::Reset");
     ghostMultiplier = 1;
     vulnerabilityTimer = 0;
 
@@ -26,20 +66,144 @@ void PacGame::Reset()
         }
     }
 
-    COORD Position;
-    Position.X = 0;
-    Position.Y = 0;
-    SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), Position);
-    // Render all components
+    // Everything is drawn again on the next Render()
     mGameMap.clearRenderQueue();
-    mGameMap.renderMap(true);
-    mScoreBoard.Render();
-    mLivesBoard.Render();
-    mCreditsBoard.Render();
-    RenderAI();
-    mPlayer.Render();
+    fullRedrawPending = true;
 } // END Reset
 
+/****************************************************************************
+Function: setRandomSeed
+Parameter(s): unsigned - Seed for the game
+Output: N/A
+Comments: Reseeds the streams every random decision in the game draws on,
+          one per Ghost, so two games with the same seed and input play
+          out identically whichever threads they run on.
+****************************************************************************/
+void PacGame::setRandomSeed(unsigned seed)
+{
+    randomSeed = seed;
+    for (int i = 0; i < MAX_ENEMIES; ++i) {
+        mGhosts[i].setRandomStream(seed, (unsigned)i + 1);
+    }
+} // END setRandomSeed
+
+/****************************************************************************
+Function: SetStartingLevel
+Parameter(s): int - Level number to start the game on.
+Output: N/A
+Comments: Loads the requested level before the first credit is played.
+****************************************************************************/
+void PacGame::SetStartingLevel(int level)
+{
+    mGameMap.setCurrentLevel(level);
+    mGameMap.loadMap();
+    Reset();
+} // END SetStartingLevel
+
+/****************************************************************************
+Function: SaveSnapshot
+Parameter(s): GameSnapshot & - Receives the state of the game
+Output: bool - False if the level is too large for a snapshot.
+Comments: Copies out every piece of simulation state; together with the
+          same input from here on, RestoreSnapshot() on any PacGame plays
+          on exactly as this one does.
+****************************************************************************/
+bool PacGame::SaveSnapshot(GameSnapshot &snapshot)
+{
+    if (mGameMap.getPelletWordCount() > SNAPSHOT_BOARD_WORDS) {
+        return false;
+    }
+    // Cleared as a whole so equal games give byte-identical snapshots
+    memset(&snapshot, 0, sizeof(snapshot));
+    memcpy(snapshot.magic, SNAPSHOT_MAGIC, sizeof(snapshot.magic));
+    snapshot.version = SNAPSHOT_FORMAT_VERSION;
+    snapshot.size = sizeof(GameSnapshot);
+
+    snapshot.level = mGameMap.getCurrentLevel();
+    snapshot.mapWidth = mGameMap.getMapWidth();
+    snapshot.mapHeight = mGameMap.getMapHeight();
+    snapshot.gameState = gameState;
+    snapshot.lastAISpawnTime = lastAISpawnTime;
+    snapshot.vulnerabilityTimer = vulnerabilityTimer;
+    snapshot.restartDelayTimer = restartDelayTimer;
+    snapshot.ghostMultiplier = ghostMultiplier;
+    snapshot.gameTicks = gameTicks;
+    snapshot.gameTime = gameTime;
+    snapshot.lastInputBits = lastInputBits;
+    snapshot.randomSeed = randomSeed;
+    snapshot.score = mScoreBoard.getScoreTotal();
+    snapshot.livesLeft = mLivesBoard.getLivesLeft();
+    snapshot.credits = mCreditsBoard.getCreditTotal();
+    snapshot.creditInserted = creditInserted ? 1 : 0;
+
+    snapshot.statusText = STATUS_LEVEL;
+    for (int i = 0; i < STATUS_LEVEL; ++i) {
+        if (strcmp(statusText, SNAPSHOT_STATUS_TEXT_TABLE[i]) == 0) {
+            snapshot.statusText = i;
+            break;
+        }
+    }
+
+    mPlayer.SaveMovement(snapshot.player);
+    for (int i = 0; i < MAX_ENEMIES; ++i) {
+        mGhosts[i].SaveState(snapshot.ghosts[i]);
+    }
+    mGameMap.savePellets(snapshot.pellets, snapshot.powerPellets);
+    return true;
+} // END SaveSnapshot
+
+/****************************************************************************
+Function: RestoreSnapshot
+Parameter(s): const GameSnapshot & - State from SaveSnapshot
+Output: bool - False if the snapshot's level cannot be loaded here, or is
+               not the size it was saved with; the game is left as it was.
+Comments: Loads the snapshot's level first when a different one is being
+          played.  The whole screen is redrawn on the next Render().
+****************************************************************************/
+bool PacGame::RestoreSnapshot(const GameSnapshot &snapshot)
+{
+    if (snapshot.level != mGameMap.getCurrentLevel()) {
+        // Checked before switching, levels are cached so this costs a lookup
+        std::shared_ptr<const LevelData> level = LevelData::Load(snapshot.level);
+        if (!level || level->getWidth() != snapshot.mapWidth || level->getHeight() != snapshot.mapHeight) {
+            return false;
+        }
+        mGameMap.setCurrentLevel(snapshot.level);
+        if (!mGameMap.loadMap()) {
+            return false;
+        }
+    }
+    else if (snapshot.mapWidth != mGameMap.getMapWidth() || snapshot.mapHeight != mGameMap.getMapHeight()) {
+        return false;
+    }
+
+    gameState = snapshot.gameState;
+    lastAISpawnTime = snapshot.lastAISpawnTime;
+    vulnerabilityTimer = snapshot.vulnerabilityTimer;
+    restartDelayTimer = snapshot.restartDelayTimer;
+    ghostMultiplier = snapshot.ghostMultiplier;
+    gameTicks = snapshot.gameTicks;
+    gameTime = snapshot.gameTime;
+    lastInputBits = snapshot.lastInputBits;
+    randomSeed = snapshot.randomSeed;
+    mScoreBoard.setScoreTotal((int)snapshot.score);
+    mLivesBoard.setLivesLeft(snapshot.livesLeft);
+    mCreditsBoard.setCredits(snapshot.credits);
+    creditInserted = snapshot.creditInserted != 0;
+
+    mPlayer.RestoreMovement(snapshot.player);
+    for (int i = 0; i < MAX_ENEMIES; ++i) {
+        mGhosts[i].RestoreState(snapshot.ghosts[i], &mPlayer);
+    }
+    mGameMap.restorePellets(snapshot.pellets, snapshot.powerPellets);
+
+    RenderStatusText((snapshot.statusText >= 0 && snapshot.statusText < STATUS_LEVEL) ?
+                     SNAPSHOT_STATUS_TEXT_TABLE[snapshot.statusText] : mGameMap.getCurrentLevelString());
+    mGameMap.clearRenderQueue();
+    fullRedrawPending = true;
+    return true;
+} // END RestoreSnapshot
+
 /****************************************************************************
 Function: RestartLevel
 Parameter(s): N/A
@@ -50,7 +214,7 @@ void PacGame::RestartLevel()
 {
     mGameMap.setCharacterAtPosition(' ', (int)mPlayer.getXPosition(), (int)mPlayer.getYPosition());
     Reset();
-    restartDelayTimer = GetTickCount();
+    restartDelayTimer = gameTime;
     mLivesBoard.decLives();
 
     if (mLivesBoard.getLivesLeft() >= 0) {
@@ -81,7 +245,7 @@ void PacGame::TriggerNewLevel()
     }
     mGameMap.loadMap();
     Reset();
-    restartDelayTimer = GetTickCount();
+    restartDelayTimer = gameTime;
 } // END TriggerNewLevel
 
 /****************************************************************************
@@ -99,7 +263,7 @@ void PacGame::PauseGame()
     }
     else if (gameState == PAUSED) {
         gameState = RUNNING;
-        lastAISpawnTime = GetTickCount();
+        lastAISpawnTime = gameTime;
         ClearStatusText();
     }
 } // END PauseGame
@@ -108,30 +272,36 @@ void PacGame::PauseGame()
 Function: Update
 Parameter(s): N/A
 Output: N/A
-Comments: Game Update on time interval
+Comments: Game Update for a single simulation tick
 ****************************************************************************/
-void PacGame::Update(double timeStep)
+void PacGame::Update()
 {
+    TRACE_SCOPE("PacGame::Update");
     if (gameState == RUNNING) {
-        if (mGameMap.getTotalDotsRemaining() <= 0) {
+        int dotsRemaining = mGameMap.getTotalDotsRemaining();
+        if (dotsRemaining <= 0) {
             mGameMap.incrementCurrentLevel();
-            restartDelayTimer = GetTickCount();
+            restartDelayTimer = gameTime;
             RenderStatusText(mGameMap.getCurrentLevelString());
             gameState = NEXT_LEVEL;
         }
         else if (!IsGameRunning()) {
             RenderStatusText(GAMEOVER_TEXT);
-            restartDelayTimer = GetTickCount();
+            restartDelayTimer = gameTime;
             gameState = GAME_OVER;
         }
+        else if (dotsRemaining <= LEVEL_PREFETCH_DOTS_REMAINING) {
+            // Have the next level ready before this one is cleared
+            mGameMap.prefetchLevel(mGameMap.getCurrentLevel() + 1);
+        }
         
         // Move Character
-        UpdatePlayerCharacter(timeStep);
+        UpdatePlayerCharacter();
 
         // Move AI
-        UpdateAICharacters(timeStep);
+        UpdateAICharacters();
 
-        if (vulnerabilityTimer > 0 && GetTickCount() - vulnerabilityTimer > VULNERABILITY_TIME_LIMIT) {
+        if (vulnerabilityTimer > 0 && gameTime - vulnerabilityTimer > VULNERABILITY_TIME_LIMIT) {
             // Reset all of the AI Characters Vulnerability
             setAllGhostsVulnerable(false);
         }
@@ -180,8 +350,7 @@ void PacGame::TriggerGhostEaten(GhostEntity &entity)
 {
     mScoreBoard.addScoreTotal(GHOST_SCORE_AMOUNT*ghostMultiplier++);
     entity.Reset();
-    entity.setRespawnTimer(GetTickCount());
-    entity.Render();
+    entity.setRespawnTimer(gameTime);
 } // END TriggerGhostEaten
 
 /****************************************************************************
@@ -190,26 +359,28 @@ Parameter(s): N/A
 Output: N/A
 Comments: Update all Active AI currently on the Map
 ****************************************************************************/
-void PacGame::UpdateAICharacters(double timeStep) 
+void PacGame::UpdateAICharacters() 
 {
+    TRACE_SCOPE("PacGame::UpdateAICharacters");
     for (int i = 0; i < MAX_ENEMIES; ++i) {
         if (!mGhosts[i].isActive()) {
             int respawnTimer = mGhosts[i].getRespawnTimer();
-            if (GetTickCount() - lastAISpawnTime > GHOST_SPAWN_TIMER && (!respawnTimer || GetTickCount() - respawnTimer > GHOST_SPAWN_TIMER * 4)) {
-                mGameMap.pushRenderQueuePosition(GameMap::RenderQueuePosition((int)mGhosts[i].getXPosition(), (int)mGhosts[i].getYPosition()));
+            if (gameTime - lastAISpawnTime > GHOST_SPAWN_TIMER && (!respawnTimer || gameTime - respawnTimer > GHOST_SPAWN_TIMER * 4)) {
+                InvalidateMapPosition((int)mGhosts[i].getXPosition(), (int)mGhosts[i].getYPosition());
                 mGhosts[i].initializeGhost();
                 mGhosts[i].setTarget(&mPlayer);
-                lastAISpawnTime = GetTickCount();
+                lastAISpawnTime = gameTime;
             }
             continue;
         }
         int xPos = (int)mGhosts[i].getXPosition();
         int yPos = (int)mGhosts[i].getYPosition();
 
-        mGhosts[i].Update(mGameMap.getAvailableDirectionsForPosition(xPos, yPos), timeStep);
+        mGhosts[i].Update(mGameMap.getAvailableDirectionsForPosition(xPos, yPos), MILLISECONDS_PER_TICK);
 
-        if (mGhosts[i].IsInvalidated()) {
-            mGameMap.pushRenderQueuePosition(GameMap::RenderQueuePosition(xPos, yPos));
+        // Restore the Map tile the Ghost just left
+        if ((int)mGhosts[i].getXPosition() != xPos || (int)mGhosts[i].getYPosition() != yPos) {
+            InvalidateMapPosition(xPos, yPos);
         }
     } // END For(i<MAX_ENEMIES)
 
@@ -224,24 +395,26 @@ Comments: Checks for collisions of Player against the Map and Active Ghosts.
 *********************************************************************************/
 void PacGame::CheckCollisions() 
 {
+    TRACE_SCOPE("PacGame::CheckCollisions");
     char charAtPos = ' ';
     int xPos = (int)mPlayer.getXPosition();
     int yPos = (int)mPlayer.getYPosition();
     charAtPos = mGameMap.getCharacterAtPosition(xPos, yPos);
+    unsigned char tileClass = GetTileClass(charAtPos);
 
-    if (charAtPos == NORML_PELLET_CHARACTER)
+    if (tileClass & TILE_PELLET)
     {
-        mGameMap.decrementDotsRemaining();
+        Metrics::Increment(COUNTER_PELLETS_CONSUMED);
         mGameMap.setCharacterAtPosition(' ', xPos, yPos);
         mScoreBoard.addPointsForPickup(charAtPos);
     }
-    else if (charAtPos == POWER_PELLET_CHARACTER)
+    else if (tileClass & TILE_POWER_PELLET)
     {
-        mGameMap.decrementDotsRemaining();
+        Metrics::Increment(COUNTER_PELLETS_CONSUMED);
         mGameMap.setCharacterAtPosition(' ', xPos, yPos);
         setAllGhostsVulnerable(true);
         ghostMultiplier = 1;
-        vulnerabilityTimer = GetTickCount();
+        vulnerabilityTimer = gameTime;
         mScoreBoard.addPointsForPickup(charAtPos);
     }
 
@@ -268,17 +441,16 @@ Output: N/A
 Comments: Input Update for Player object.  Command Queue logic used for ensuring
 the next possible move in the direction queued will be attempted.
 *********************************************************************************/
-void PacGame::UpdatePlayerCharacter(double timeStep)
+void PacGame::UpdatePlayerCharacter()
 {
-    int cacheXPos = (int)mPlayer.getXPosition();
-    int cacheYPos = (int)mPlayer.getYPosition();
-    mPlayer.Update(mGameMap.getAvailableDirectionsForPosition(cacheXPos, cacheYPos), timeStep);
-    int xPos = (int)mPlayer.getXPosition();
-    int yPos = (int)mPlayer.getYPosition();
-
-    // Player is invalidated if a Move has occurred
-    if (mPlayer.IsInvalidated()) {
-        mGameMap.pushRenderQueuePosition(GameMap::RenderQueuePosition(cacheXPos, cacheYPos));
+    TRACE_SCOPE("PacGame::UpdatePlayerCharacter");
+    double cacheXPos = mPlayer.getXPosition();
+    double cacheYPos = mPlayer.getYPosition();
+    mPlayer.Update(mGameMap.getAvailableDirectionsForPosition((int)cacheXPos, (int)cacheYPos), MILLISECONDS_PER_TICK);
+
+    // Check the map only if a Move has occurred
+    if (mPlayer.getXPosition() != cacheXPos || mPlayer.getYPosition() != cacheYPos) {
+        InvalidateMapPosition((int)cacheXPos, (int)cacheYPos);
         CheckCollisions();
     }
 } // END UpdatePlayerCharacter
@@ -307,18 +479,23 @@ void PacGame::setAllGhostsVulnerable(bool status)
 
 /****************************************************************************
 Function: GatherGamePlayInput
-Parameter(s): N/A
+Parameter(s): unsigned - GAME_INPUTS bits (See @Constants.h) pressed this tick.
 Output: N/A
-Comments: State machine for the GameState, retrieves input and updates Player
+Comments: State machine for the GameState, applies input and updates Player
 when detected.
 ****************************************************************************/
-void PacGame::GatherGamePlayInput()
+void PacGame::GatherGamePlayInput(unsigned inputBits)
 {
+    TRACE_SCOPE("PacGame::GatherGamePlayInput");
+    // Pause is edge triggered so holding the key does not toggle every tick
+    bool pausePressed = (inputBits & INPUT_PAUSE_BIT) && !(lastInputBits & INPUT_PAUSE_BIT);
+    lastInputBits = inputBits;
+
     switch (gameState)
     {
     case ATTRACT:
     {
-        if (!GetAsyncKeyState(VK_ADD))
+        if (!(inputBits & INPUT_COIN_BIT))
         {
             creditInserted = false;
         }
@@ -327,35 +504,35 @@ void PacGame::GatherGamePlayInput()
             creditInserted = true;
         }
 
-        if ((GetAsyncKeyState(VK_NUMPAD1) || GetAsyncKeyState(VK_1)) && mCreditsBoard.getCreditTotal() > 0)
+        if ((inputBits & INPUT_START_BIT) && mCreditsBoard.getCreditTotal() > 0)
         {
             mCreditsBoard.decCredits();
             ClearStatusText();
             RenderStatusText(READY_TEXT);
-            restartDelayTimer = GetTickCount();
+            restartDelayTimer = gameTime;
             gameState = READY;
         }
         break;
     }
     case RUNNING:
     {
-        if (GetAsyncKeyState(VK_LEFT))
+        if (inputBits & INPUT_LEFT_BIT)
         {
             UpdatePlayerDirection(LEFT);
         }
-        if (GetAsyncKeyState(VK_RIGHT))
+        if (inputBits & INPUT_RIGHT_BIT)
         {
             UpdatePlayerDirection(RIGHT);
         }
-        if (GetAsyncKeyState(VK_UP))
+        if (inputBits & INPUT_UP_BIT)
         {
             UpdatePlayerDirection(UP);
         }
-        if (GetAsyncKeyState(VK_DOWN))
+        if (inputBits & INPUT_DOWN_BIT)
         {
             UpdatePlayerDirection(DOWN);
         }
-        if (GetAsyncKeyState(VK_SPACE))
+        if (pausePressed || (inputBits & INPUT_FOCUS_LOST_BIT))
         {
             PauseGame();
         }
@@ -363,21 +540,22 @@ void PacGame::GatherGamePlayInput()
     }
     case READY:
     {
-        if (GetTickCount() - restartDelayTimer > 3000) {
+        if (gameTime - restartDelayTimer > STATE_TRANSITION_DELAY) {
             gameState = RUNNING;
-            lastAISpawnTime = GetTickCount();
+            lastAISpawnTime = gameTime;
             ClearStatusText();
             vulnerabilityTimer = 0;
         }
     }
     case PAUSED:
-        if (GetAsyncKeyState(VK_SPACE))
+        // A game that loses focus pauses, but losing focus never unpauses
+        if (pausePressed || ((inputBits & INPUT_FOCUS_LOST_BIT) && gameState == RUNNING))
         {
             PauseGame();
         }
         break;
     case NEXT_LEVEL:
-        if (GetTickCount() - restartDelayTimer > 3000) {
+        if (gameTime - restartDelayTimer > STATE_TRANSITION_DELAY) {
             TriggerNewLevel();
             gameState = READY;
             RenderStatusText(READY_TEXT);
@@ -385,7 +563,7 @@ void PacGame::GatherGamePlayInput()
         break;
     case GAME_OVER:
     {
-        if (GetTickCount() - restartDelayTimer > 3000) {
+        if (gameTime - restartDelayTimer > STATE_TRANSITION_DELAY) {
             ClearStatusText();
             TriggerNewLevel();
             RenderStatusText(PRESS_START_TEXT);
@@ -398,58 +576,79 @@ void PacGame::GatherGamePlayInput()
 } // END GatherGamePlayInput
 
 /****************************************************************************
-Function: Render
-Parameter(s): N/A
+Function: AttachRenderEngine
+Parameter(s): RenderEngine & - Engine the game is drawn with.
 Output: N/A
-Comments: Renders the entire frame and update for all Objects for Game.
+Comments: Sizes the engine to the screen and registers every Entity that is
+          drawn each frame.  Ghosts are added last so they are drawn on top
+          of the Player.  Headless games never attach an engine.
 ****************************************************************************/
-void PacGame::Render()
+void PacGame::AttachRenderEngine(RenderEngine &engine)
 {
-    mScoreBoard.Render();
-    mLivesBoard.Render();
-    mCreditsBoard.Render();
-    mGameMap.renderMap();
-    mPlayer.Render();
-    RenderAI();
-
-    // TODO: Add the RenderEngine to run through all TrackedEntities for Rendering
-    //          Score, Lives, Credits, etc.
-} // END Render
+    mRenderEngine = &engine;
+    engine.InitializeEngine(SCREEN_BUFFER_WIDTH, SCREEN_BUFFER_HEIGHT);
+    engine.RemoveAllEntities();
+    engine.AddEntity(mScoreBoard);
+    engine.AddEntity(mLivesBoard);
+    engine.AddEntity(mCreditsBoard);
+    engine.AddEntity(mPlayer);
+    for (int i = 0; i < MAX_ENEMIES; ++i) {
+        engine.AddEntity(mGhosts[i]);
+    }
+    fullRedrawPending = true;
+} // END AttachRenderEngine
 
 /****************************************************************************
-Function: RenderAI
+Function: Render
 Parameter(s): N/A
 Output: N/A
-Comments: Renders the Active Ghost AI on-screen at their present positions.
+Comments: Draws the frame into the RenderEngine back buffer.  The Map only
+          redraws the tiles that were invalidated, the tracked entities are
+          drawn every frame; RenderEngine::Present() works out what actually
+          changed on screen.
 ****************************************************************************/
-void PacGame::RenderAI()
+void PacGame::Render()
 {
-    for (int i = 0; i < MAX_ENEMIES; ++i) {
-        mGhosts[i].Render();
+    TRACE_SCOPE("PacGame::Render");
+    if (mRenderEngine == nullptr) {
+        return;
+    }
+
+    if (fullRedrawPending) {
+        Metrics::Increment(COUNTER_FULL_REDRAWS);
+        mRenderEngine->PrepareBuffer();
+        mGameMap.renderMap(*mRenderEngine, true);
+        statusTextInvalidated = true;
+        fullRedrawPending = false;
+    }
+    else {
+        mGameMap.renderMap(*mRenderEngine);
+    }
+
+    if (statusTextInvalidated) {
+        // Attempt to pad the string display to center the text
+        // under the Ghost Spawn box
+        mRenderEngine->DrawString(STATUS_TEXT_OFFSET_MARGIN, STATUS_TEXT_HEIGHT_POSITION, CLEAR_STATUS_TEXT, ATTR_DEFAULT);
+        mRenderEngine->DrawString(STATUS_TEXT_OFFSET_MARGIN + (STATUS_TEXT_WIDTH - (int)strlen(statusText)) / 2,
+                                  STATUS_TEXT_HEIGHT_POSITION, statusText, ATTR_DEFAULT);
+        statusTextInvalidated = false;
     }
-} // END RenderAI
+
+    mRenderEngine->RenderEntities();
+} // END Render
 
 /****************************************************************************
 Function: RenderStatusText
 Parameter(s): const char * - String to display in the line below the Ghost
 Spawn box.
 Output: N/A
-Comments: Renders string to screen below Ghost Spawn box.
+Comments: Queues the string to be rendered below the Ghost Spawn box on the
+next Render().
 ****************************************************************************/
 void PacGame::RenderStatusText(const char *stringToDisplay) 
 {
-    COORD Position;
-    Position.X = STATUS_TEXT_OFFSET_MARGIN;
-    Position.Y = 16;
-    SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), Position);
-    // Attempt to pad the string display to center the text 
-    // under the Ghost Spawn box
-    int length = strlen(stringToDisplay);
-    length = (15 - length) / 2;
-    for (int i = 0; i < length; ++i) {
-        cout << ' ';
-    }
-    cout << stringToDisplay;
+    statusText = stringToDisplay;
+    statusTextInvalidated = true;
 } // END RenderStatusText
 
 /****************************************************************************
@@ -461,9 +660,20 @@ the Ghost Spawn box
 ****************************************************************************/
 void PacGame::ClearStatusText() 
 {
-    COORD Position;
-    Position.X = STATUS_TEXT_OFFSET_MARGIN;
-    Position.Y = 16;
-    SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), Position);
-    cout << CLEAR_STATUS_TEXT;
-} // END ClearStatusText
\ No newline at end of file
+    RenderStatusText(CLEAR_STATUS_TEXT);
+} // END ClearStatusText
+
+/****************************************************************************
+Function: InvalidateMapPosition
+Parameter(s): int - X Position within Map
+              int - Y Position within Map
+Output: N/A
+Comments: Queues a Map tile to be redrawn.  Headless games never render, so
+nothing is queued for them.
+****************************************************************************/
+void PacGame::InvalidateMapPosition(int xPos, int yPos)
+{
+    if (!mHeadless) {
+        mGameMap.pushRenderQueuePosition(GameMap::RenderQueuePosition(xPos, yPos));
+    }
+} // END InvalidateMapPosition
\ No newline at end of file
@@ -5,11 +5,9 @@ TODO: Make class Singleton
 ****************************************************************************/
 #ifndef _PAC_GAME_H_
 #define _PAC_GAME_H_
-#include <iostream>
-using namespace std;
-#include <Windows.h>
 #include "Constants.h"
 #include "RenderEngine.h"
+#include "InputSource.h"
 
 #include "GameMap.h"
 #include "GhostEntity.h"
@@ -17,12 +15,27 @@ using namespace std;
 #include "ScoreBoard.h"
 #include "LivesBoard.h"
 #include "CreditsBoard.h"
+#include "GameSnapshot.h"
 
 class PacGame {
 public:
     int gameState, lastAISpawnTime, vulnerabilityTimer, restartDelayTimer, ghostMultiplier;
     bool creditInserted;
-    
+
+    // Simulation clock: advances by MILLISECONDS_PER_TICK for every Step()
+    unsigned gameTicks;
+    int gameTime;
+    unsigned lastInputBits;
+    // Everything random in a game derives from this seed
+    unsigned randomSeed;
+    InputSource *mInputSource;
+    NullInputSource mNullInput;
+    RenderEngine *mRenderEngine;
+
+    // Presentation state, only consumed by Render()
+    bool mHeadless, fullRedrawPending, statusTextInvalidated;
+    const char *statusText;
+
     PlayerEntity mPlayer;
     GhostEntity mGhosts[MAX_ENEMIES];
     GameMap mGameMap;
@@ -31,24 +44,30 @@ public:
     LivesBoard mLivesBoard;
     CreditsBoard mCreditsBoard;
 
-    PacGame()
+    PacGame(InputSource *inputSource = nullptr, bool headless = false)
     {
         // Initialize all game data
         gameState = ATTRACT;
+        gameTicks = 0;
+        gameTime = 0;
+        lastInputBits = 0;
+        setRandomSeed(1);
+        lastAISpawnTime = vulnerabilityTimer = restartDelayTimer = 0;
+        mHeadless = headless;
+        mRenderEngine = nullptr;
+        statusText = CLEAR_STATUS_TEXT;
+        statusTextInvalidated = false;
+        setInputSource(inputSource);
 
         mScoreBoard.setPosition(mGameMap.getMapWidth() + SCREEN_OFFSET_MARGIN * 2, SCORE_BOARD_HEIGHT_POSITION);
 
         mLivesBoard.setPosition(mGameMap.getMapWidth() + SCREEN_OFFSET_MARGIN * 2, LIVES_BOARD_HEIGHT_POSITION);
-        
+
         mCreditsBoard.setPosition(SCREEN_OFFSET_MARGIN, mGameMap.getMapHeight());
 
         ghostMultiplier = 1;
         creditInserted = false;
 
-        {
-            RenderEngine &inst = RenderEngine::GetInstance();
-            inst.InitializeEngine();
-        }
         Reset();
         RenderStatusText(PRESS_START_TEXT);
     } // End Constructor
@@ -57,22 +76,36 @@ public:
     bool IsGameRunning() { return !((gameState == GAME_OVER || gameState == RUNNING) && IsGameOver()); }
     bool IsGameOver()    { return (mLivesBoard.getLivesLeft() < 0); }
     bool IsPaused() { return (gameState == PAUSED); }
+    // Nothing changes in these states until a key is pressed
+    bool IsIdle() { return (gameState == ATTRACT || gameState == PAUSED); }
+    bool IsHeadless() { return mHeadless; }
     int  getGameState()  { return gameState; }
+    int  getGameTime()   { return gameTime; }
+    unsigned getGameTicks() { return gameTicks; }
+    void setInputSource(InputSource *inputSource) { mInputSource = (inputSource != nullptr) ? inputSource : &mNullInput; }
+    unsigned getRandomSeed() { return randomSeed; }
+    void setRandomSeed(unsigned seed);
+    void Step();
+    void FinishStep(unsigned inputBits);
     void Reset();
+    void SetStartingLevel(int level);
+    bool SaveSnapshot(GameSnapshot &snapshot);
+    bool RestoreSnapshot(const GameSnapshot &snapshot);
     void RestartLevel();
     void PauseGame();
-    void Update(double timeStep);
+    void Update();
     bool CanMoveInSpecifiedDirection(int direction, int xPos, int yPos, int movementSpeed = 1);
     void TriggerGhostEaten(GhostEntity &entity);
     void TriggerNewLevel();
-    void UpdateAICharacters(double timeStep);
+    void UpdateAICharacters();
     void CheckCollisions();
-    void UpdatePlayerCharacter(double timeStep);
+    void UpdatePlayerCharacter();
     void UpdatePlayerDirection(int direction);
     void setAllGhostsVulnerable(bool status);
-    void GatherGamePlayInput();
+    void GatherGamePlayInput(unsigned inputBits);
+    void InvalidateMapPosition(int xPos, int yPos);
+    void AttachRenderEngine(RenderEngine &engine);
     void Render();
-    void RenderAI();
     void RenderStatusText(const char *stringToDisplay);
     void ClearStatusText();
 };
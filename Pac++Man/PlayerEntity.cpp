@@ -1,6 +1,5 @@
 #include "PlayerEntity.h"
-#include <Windows.h>
-#include <iostream>
+#include "RenderEngine.h"
 
 PlayerEntity::PlayerEntity() {
     // Initialize all Player Character Icons
@@ -8,7 +7,6 @@ PlayerEntity::PlayerEntity() {
     playerCharacterIcons[UP] = 0x56;
     playerCharacterIcons[RIGHT] = 0x3C;
     playerCharacterIcons[DOWN] = 0x5E;
-    setInvalidated(true);
     setMovementSpeed(MOVING_ENTITY_DEFAULT_SPEED);
     Reset();
 }
@@ -21,7 +19,6 @@ Comments: Used to reset the status of the PlayerEntity to base.
 ****************************************************************************/
 void PlayerEntity::Reset() {
     currentPlayerIcon = playerCharacterIcons[LEFT];
-    setInvalidated(true);
     setMovementDirection(MAX_DIRECTION);
     setXPos(DEFAULT_PLAYER_X_POSITION);
     setYPos(DEFAULT_PLAYER_Y_POSITION);
@@ -29,20 +26,12 @@ void PlayerEntity::Reset() {
 
 /****************************************************************************
 Function: Render
-Parameter(s): bool - Boolean value on whether the Position needs to be set
-prior to rendering the Player character icon.
+Parameter(s): RenderEngine & - Engine whose back buffer is drawn into.
 Output: N/A
 Comments: Renders the Player to screen at the Position stored internally.
 ****************************************************************************/
-void PlayerEntity::Render() {
-    if (isInvalidated) {
-        COORD Position;
-        Position.X = (int)xPos + SCREEN_OFFSET_MARGIN;
-        Position.Y = (int)yPos;
-        SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), Position);
-        std::cout << "\033[33;1m" << this->getIconForDirection() << "\033[0m";
-        setInvalidated(false);
-    }
+void PlayerEntity::Render(RenderEngine &engine) {
+    engine.DrawCharacter((int)xPos + SCREEN_OFFSET_MARGIN, (int)yPos, this->getIconForDirection(), ATTR_HIGHLIGHT_TEXT);
 } // END Render
 
 /****************************************************************************
@@ -80,7 +69,6 @@ void PlayerEntity::Move(double timeStep) {
     double yPos = getYPosition();
     double nextPos = 0.0;
 
-    setInvalidated(true);
     switch (movementDirection)
     {
     case LEFT:
@@ -16,7 +16,7 @@ public:
     virtual ~PlayerEntity() { }
     virtual void Update(unsigned validDirections, double timeStep);
     virtual void Move(double timeStep);
-    virtual void Render();
+    virtual void Render(RenderEngine &engine);
     virtual void Reset();
     char getPlayerIcon() { return this->currentPlayerIcon; }
     char getIconForDirection(int direction = -1) { return (direction < 0)? 
@@ -0,0 +1,64 @@
+/****************************************************************************
+File: Random.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _RANDOM_H_
+#define _RANDOM_H_
+
+/****************************************************************************
+Class: Random
+Comments: xoshiro128** generator: 16 bytes of state, a handful of shifts
+          and rotates per number, and no global state, so every game (and
+          every ghost in it) draws from its own copy and games on different
+          threads never touch each other.  The state is filled by running
+          SplitMix64 over the seed and a stream number, so one seed gives
+          any number of unrelated streams.
+****************************************************************************/
+class Random {
+private:
+    unsigned mState[4];
+
+    static unsigned RotateLeft(unsigned value, int bits) { return (value << bits) | (value >> (32 - bits)); }
+
+    static unsigned long long SplitMix64(unsigned long long &state) {
+        unsigned long long z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+public:
+    explicit Random(unsigned long long seed = 1, unsigned stream = 0) { Seed(seed, stream); }
+
+    void Seed(unsigned long long seed, unsigned stream = 0) {
+        unsigned long long mixer = seed ^ ((unsigned long long)stream * 0xD1B54A32D192ED03ULL);
+        unsigned long long first = SplitMix64(mixer), second = SplitMix64(mixer);
+        mState[0] = (unsigned)first;
+        mState[1] = (unsigned)(first >> 32);
+        mState[2] = (unsigned)second;
+        mState[3] = (unsigned)(second >> 32);
+        if ((mState[0] | mState[1] | mState[2] | mState[3]) == 0) {
+            // The one state xoshiro never leaves
+            mState[0] = 1;
+        }
+    }
+
+    unsigned Next() {
+        const unsigned result = RotateLeft(mState[1] * 5, 7) * 9;
+        const unsigned shifted = mState[1] << 9;
+        mState[2] ^= mState[0];
+        mState[3] ^= mState[1];
+        mState[1] ^= mState[2];
+        mState[0] ^= mState[3];
+        mState[2] ^= shifted;
+        mState[3] = RotateLeft(mState[3], 11);
+        return result;
+    }
+
+    // For snapshots: the whole generator is these four words
+    void getState(unsigned state[4]) const { for (int i = 0; i < 4; ++i) state[i] = mState[i]; }
+    void setState(const unsigned state[4]) { for (int i = 0; i < 4; ++i) mState[i] = state[i]; }
+
+    // Uniform in [0, bound), by multiply and shift rather than modulo
+    unsigned NextBelow(unsigned bound) { return (unsigned)(((unsigned long long)Next() * bound) >> 32); }
+};
+#endif // _RANDOM_H_
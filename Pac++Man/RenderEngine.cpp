@@ -1,27 +1,439 @@
+/****************************************************************************
+File: RenderEngine.cpp
+Author: fookenCode
+****************************************************************************/
 #include "RenderEngine.h"
+#include "Metrics.h"
+#include "TraceRecorder.h"
 #include <memory.h>
-void RenderEngine::InitializeEngine(int bufferSize) {
+#include <cstring>
+
+// ANSI colours are RGB ordered, Win32 colour bits are BGR ordered.  The
+// mapping is its own inverse, so it converts in both directions.
+static const unsigned char ANSI_COLOR_ORDER[8] = { 0, 4, 2, 6, 1, 5, 3, 7 };
+
+#ifndef _WIN32
+// Glyphs are stored as code page 437 bytes, which is what the Windows
+// console shows.  POSIX terminals expect UTF-8, so the upper half of the
+// code page is translated when a cell is written out.
+static const char *CP437_UPPER_HALF_UTF8[128] = {
+    "\xC3\x87", "\xC3\xBC", "\xC3\xA9", "\xC3\xA2", "\xC3\xA4", "\xC3\xA0", "\xC3\xA5", "\xC3\xA7",
+    "\xC3\xAA", "\xC3\xAB", "\xC3\xA8", "\xC3\xAF", "\xC3\xAE", "\xC3\xAC", "\xC3\x84", "\xC3\x85",
+    "\xC3\x89", "\xC3\xA6", "\xC3\x86", "\xC3\xB4", "\xC3\xB6", "\xC3\xB2", "\xC3\xBB", "\xC3\xB9",
+    "\xC3\xBF", "\xC3\x96", "\xC3\x9C", "\xC2\xA2", "\xC2\xA3", "\xC2\xA5", "\xE2\x82\xA7", "\xC6\x92",
+    "\xC3\xA1", "\xC3\xAD", "\xC3\xB3", "\xC3\xBA", "\xC3\xB1", "\xC3\x91", "\xC2\xAA", "\xC2\xBA",
+    "\xC2\xBF", "\xE2\x8C\x90", "\xC2\xAC", "\xC2\xBD", "\xC2\xBC", "\xC2\xA1", "\xC2\xAB", "\xC2\xBB",
+    "\xE2\x96\x91", "\xE2\x96\x92", "\xE2\x96\x93", "\xE2\x94\x82", "\xE2\x94\xA4", "\xE2\x95\xA1", "\xE2\x95\xA2", "\xE2\x95\x96",
+    "\xE2\x95\x95", "\xE2\x95\xA3", "\xE2\x95\x91", "\xE2\x95\x97", "\xE2\x95\x9D", "\xE2\x95\x9C", "\xE2\x95\x9B", "\xE2\x94\x90",
+    "\xE2\x94\x94", "\xE2\x94\xB4", "\xE2\x94\xAC", "\xE2\x94\x9C", "\xE2\x94\x80", "\xE2\x94\xBC", "\xE2\x95\x9E", "\xE2\x95\x9F",
+    "\xE2\x95\x9A", "\xE2\x95\x94", "\xE2\x95\xA9", "\xE2\x95\xA6", "\xE2\x95\xA0", "\xE2\x95\x90", "\xE2\x95\xAC", "\xE2\x95\xA7",
+    "\xE2\x95\xA8", "\xE2\x95\xA4", "\xE2\x95\xA5", "\xE2\x95\x99", "\xE2\x95\x98", "\xE2\x95\x92", "\xE2\x95\x93", "\xE2\x95\xAB",
+    "\xE2\x95\xAA", "\xE2\x94\x98", "\xE2\x94\x8C", "\xE2\x96\x88", "\xE2\x96\x84", "\xE2\x96\x8C", "\xE2\x96\x90", "\xE2\x96\x80",
+    "\xCE\xB1", "\xC3\x9F", "\xCE\x93", "\xCF\x80", "\xCE\xA3", "\xCF\x83", "\xC2\xB5", "\xCF\x84",
+    "\xCE\xA6", "\xCE\x98", "\xCE\xA9", "\xCE\xB4", "\xE2\x88\x9E", "\xCF\x86", "\xCE\xB5", "\xE2\x88\xA9",
+    "\xE2\x89\xA1", "\xC2\xB1", "\xE2\x89\xA5", "\xE2\x89\xA4", "\xE2\x8C\xA0", "\xE2\x8C\xA1", "\xC3\xB7", "\xE2\x89\x88",
+    "\xC2\xB0", "\xE2\x88\x99", "\xC2\xB7", "\xE2\x88\x9A", "\xE2\x81\xBF", "\xC2\xB2", "\xE2\x96\xA0", "\xC2\xA0",
+};
+#endif
+
+/****************************************************************************
+Function: GlyphLength
+Parameter(s): char - Glyph as stored in a ScreenCell
+Output: int - Bytes the glyph takes on the terminal.
+Comments: N/A
+****************************************************************************/
+static inline int GlyphLength(char glyph) {
+#ifdef _WIN32
+    return 1;
+#else
+    return ((unsigned char)glyph >= 0x80) ? (int)strlen(CP437_UPPER_HALF_UTF8[(unsigned char)glyph - 0x80]) : 1;
+#endif
+} // END GlyphLength
+
+/****************************************************************************
+Function: NumberLength
+Parameter(s): int - Non-negative value
+Output: int - Decimal digits needed to print the value.
+Comments: N/A
+****************************************************************************/
+static inline int NumberLength(int value) {
+    int digits = 1;
+    while (value >= 10) {
+        value /= 10;
+        ++digits;
+    }
+    return digits;
+} // END NumberLength
+
+/****************************************************************************
+Function: ColumnMoveCost
+Parameter(s): int - Columns to move (negative moves left)
+Output: int - Bytes of the CUF/CUB sequence, "ESC[nC" or "ESC[nD".
+Comments: A count of 1 is implied and left out.
+****************************************************************************/
+static inline int ColumnMoveCost(int columns) {
+    if (columns == 0) {
+        return 0;
+    }
+    if (columns < 0) {
+        columns = -columns;
+    }
+    return (columns == 1) ? 3 : 3 + NumberLength(columns);
+} // END ColumnMoveCost
+
+/****************************************************************************
+Function: ReleaseBuffers
+Parameter(s): N/A
+Output: N/A
+Comments: Frees both screen buffers.
+****************************************************************************/
+void RenderEngine::ReleaseBuffers() {
     if (presentBuffer != nullptr) {
         delete[] presentBuffer;
+        presentBuffer = nullptr;
     }
     if (backBuffer != nullptr) {
         delete[] backBuffer;
+        backBuffer = nullptr;
+    }
+} // END ReleaseBuffers
+
+/****************************************************************************
+Function: InitializeEngine
+Parameter(s): int - Width of the screen in characters
+              int - Height of the screen in characters
+Output: N/A
+Comments: (Re-)allocates both buffers.  The present buffer starts out
+          invalid so the first Present() paints every cell.
+****************************************************************************/
+void RenderEngine::InitializeEngine(int width, int height) {
+    ReleaseBuffers();
+    mWidth = width;
+    mHeight = height;
+    mBufferSize = width * height;
+    presentBuffer = new ScreenCell[mBufferSize];
+    backBuffer = new ScreenCell[mBufferSize];
+    // Size the arena for a full repaint so no frame ever has to grow it
+    mOutput.Reserve((size_t)mBufferSize * MAX_BYTES_PER_CELL);
+    PrepareBuffer();
+    InvalidateScreen();
+} // END InitializeEngine
+
+/****************************************************************************
+Function: AttributeFromAnsi
+Parameter(s): int - ANSI foreground colour (30-37)
+              int - ANSI background colour (40-47)
+              bool - Whether the foreground is drawn bright/bold
+Output: unsigned char - Equivalent Win32 style character attribute.
+Comments: Level files specify their colours as ANSI SGR codes.
+****************************************************************************/
+unsigned char RenderEngine::AttributeFromAnsi(int foreColor, int backColor, bool bright) {
+    unsigned char attribute = ANSI_COLOR_ORDER[(foreColor - 30) & 0x7] | (ANSI_COLOR_ORDER[(backColor - 40) & 0x7] << 4);
+    if (bright) {
+        attribute |= 0x8;
     }
-    mBufferSize = bufferSize;
-    presentBuffer = new char[bufferSize];
-    backBuffer = new char[bufferSize];
-}
+    return attribute;
+} // END AttributeFromAnsi
 
+/****************************************************************************
+Function: AddEntity
+Parameter(s): Entity & - Entity to draw every frame.
+Output: N/A
+Comments: Tracked entities are drawn by RenderEntities() in the order they
+          were added, so later entities are drawn on top.
+****************************************************************************/
 void RenderEngine::AddEntity(Entity &entity) {
+    mTrackedEntities.push_back(&entity);
+} // END AddEntity
+
+/****************************************************************************
+Function: RenderEntities
+Parameter(s): N/A
+Output: N/A
+Comments: Draws every tracked entity into the back buffer.
+****************************************************************************/
+void RenderEngine::RenderEntities() {
+    for (size_t i = 0; i < mTrackedEntities.size(); ++i) {
+        mTrackedEntities[i]->Render(*this);
+    }
+} // END RenderEntities
+
+/****************************************************************************
+Function: DrawCharacter
+Parameter(s): int - X Position on screen
+              int - Y Position on screen
+              char - Glyph to draw
+              unsigned char - Attribute to draw the glyph with
+Output: N/A
+Comments: Writes one cell into the back buffer.  Off-screen cells are
+          ignored.
+****************************************************************************/
+void RenderEngine::DrawCharacter(int xPos, int yPos, char glyph, unsigned char attribute) {
+    if (xPos < 0 || xPos >= mWidth || yPos < 0 || yPos >= mHeight) {
+        return;
+    }
+    ScreenCell &cell = backBuffer[yPos * mWidth + xPos];
+    cell.glyph = glyph;
+    cell.attribute = attribute;
+} // END DrawCharacter
 
-}
+/****************************************************************************
+Function: DrawCells
+Parameter(s): int - X Position on screen of the first cell
+              int - Y Position on screen
+              const ScreenCell * - Cells to draw, left to right
+              int - Number of cells
+Output: N/A
+Comments: Writes a run of cells into one row of the back buffer, clipped
+          once for the whole run.
+****************************************************************************/
+void RenderEngine::DrawCells(int xPos, int yPos, const ScreenCell *cells, int count) {
+    if (yPos < 0 || yPos >= mHeight) {
+        return;
+    }
+    if (xPos < 0) {
+        cells -= xPos;
+        count += xPos;
+        xPos = 0;
+    }
+    if (count > mWidth - xPos) {
+        count = mWidth - xPos;
+    }
+    if (count > 0) {
+        memcpy(&backBuffer[yPos * mWidth + xPos], cells, sizeof(ScreenCell) * count);
+    }
+} // END DrawCells
 
-// void AddNonEntity(NonEntity &nentity);
+/****************************************************************************
+Function: DrawString
+Parameter(s): int - X Position on screen of the first character
+              int - Y Position on screen
+              const char * - Text to draw
+              unsigned char - Attribute to draw the text with
+Output: N/A
+Comments: Writes a run of cells into the back buffer, clipped at the right
+          edge of the screen.
+****************************************************************************/
+void RenderEngine::DrawString(int xPos, int yPos, const char *text, unsigned char attribute) {
+    for (int i = 0; text[i] != '\0'; ++i) {
+        DrawCharacter(xPos + i, yPos, text[i], attribute);
+    }
+} // END DrawString
 
+/****************************************************************************
+Function: PrepareBuffer
+Parameter(s): N/A
+Output: N/A
+Comments: Blanks the whole back buffer, used before a full redraw.
+****************************************************************************/
 void RenderEngine::PrepareBuffer() {
-    memset(backBuffer, 0, sizeof(char)* mBufferSize);
-}
+    for (int i = 0; i < mBufferSize; ++i) {
+        backBuffer[i].glyph = ' ';
+        backBuffer[i].attribute = ATTR_DEFAULT;
+    }
+} // END PrepareBuffer
+
+/****************************************************************************
+Function: InvalidateScreen
+Parameter(s): N/A
+Output: N/A
+Comments: Forgets what the terminal shows so the next Present() repaints
+          every cell.  The terminal colour and cursor position are
+          forgotten as well, so the first cell written re-establishes them
+          from scratch.
+****************************************************************************/
+void RenderEngine::InvalidateScreen() {
+    mAttributeState.Invalidate();
+    mCursorX = mCursorY = -1;
+    memset(presentBuffer, 0, sizeof(ScreenCell) * mBufferSize);
+    for (int i = 0; i < mBufferSize; ++i) {
+        presentBuffer[i].attribute = ATTR_INVALID;
+    }
+} // END InvalidateScreen
+
+/****************************************************************************
+Function: AppendGlyph
+Parameter(s): char - Glyph to write
+Output: N/A
+Comments: Writes one glyph at the cursor and advances the tracked cursor.
+          Reaching the right edge leaves the cursor in a terminal specific
+          pending-wrap state, so its position is forgotten.
+****************************************************************************/
+void RenderEngine::AppendGlyph(char glyph) {
+#ifdef _WIN32
+    mOutput.Append(glyph);
+#else
+    if ((unsigned char)glyph >= 0x80) {
+        mOutput.Append(CP437_UPPER_HALF_UTF8[(unsigned char)glyph - 0x80]);
+    }
+    else {
+        mOutput.Append(glyph);
+    }
+#endif
+    if (++mCursorX >= mWidth) {
+        mCursorX = mCursorY = -1;
+    }
+} // END AppendGlyph
+
+/****************************************************************************
+Function: RewriteCost
+Parameter(s): int - Row the cursor is on
+              int - First column to re-write
+              int - Column just past the last one to re-write
+Output: int - Bytes needed to re-send the cells in between, or -1 if they
+              cannot be re-sent without a colour change.
+Comments: Cells in a gap are unchanged, so writing them again is invisible
+          and can be cheaper than an escape sequence for a short hop.
+****************************************************************************/
+int RenderEngine::RewriteCost(int yPos, int fromX, int toX) {
+    if (toX - fromX > MAX_REWRITE_GAP) {
+        return -1;
+    }
+    int cost = 0;
+    for (int x = fromX; x < toX; ++x) {
+        const ScreenCell &cell = presentBuffer[yPos * mWidth + x];
+        if (!mAttributeState.Matches(cell.attribute) || cell.attribute == ATTR_INVALID) {
+            return -1;
+        }
+        cost += GlyphLength(cell.glyph);
+    }
+    return cost;
+} // END RewriteCost
+
+/****************************************************************************
+Function: MoveCursor
+Parameter(s): int - X Position on screen
+              int - Y Position on screen
+Output: N/A
+Comments: Moves the terminal cursor with the fewest bytes.  Candidates are
+          an absolute CUP, a relative CUF/CUB on the same row, CR/LF down to
+          the row followed by a short column move, and re-writing the
+          unchanged glyphs in a short gap to the right.
+****************************************************************************/
+void RenderEngine::MoveCursor(int xPos, int yPos) {
+    if (xPos == mCursorX && yPos == mCursorY) {
+        return;
+    }
+
+    // ESC [ row ; col H
+    enum { MOVE_ABSOLUTE, MOVE_RELATIVE, MOVE_REWRITE, MOVE_NEWLINE };
+    int bestMove = MOVE_ABSOLUTE;
+    int bestCost = 4 + NumberLength(yPos + 1) + NumberLength(xPos + 1);
+
+    if (mCursorY >= 0) {
+        if (yPos == mCursorY) {
+            int cost = ColumnMoveCost(xPos - mCursorX);
+            if (cost < bestCost) {
+                bestMove = MOVE_RELATIVE;
+                bestCost = cost;
+            }
+            if (xPos > mCursorX) {
+                cost = RewriteCost(yPos, mCursorX, xPos);
+                if (cost >= 0 && cost < bestCost) {
+                    bestMove = MOVE_REWRITE;
+                    bestCost = cost;
+                }
+            }
+        }
+        if (yPos >= mCursorY) {
+            // CR LF per row (CR alone when staying on the row) lands in
+            // column 0 whether or not the terminal translates LF
+            int rows = yPos - mCursorY;
+            int cost = (rows == 0) ? 1 : rows * 2;
+            if (cost < bestCost) {
+                int columnCost = ColumnMoveCost(xPos);
+                int rewriteCost = RewriteCost(yPos, 0, xPos);
+                if (rewriteCost >= 0 && rewriteCost < columnCost) {
+                    columnCost = rewriteCost;
+                }
+                if (cost + columnCost < bestCost) {
+                    bestMove = MOVE_NEWLINE;
+                    bestCost = cost + columnCost;
+                }
+            }
+        }
+    }
+
+    switch (bestMove) {
+    case MOVE_ABSOLUTE:
+        mOutput.Append("\033[", 2);
+        mOutput.AppendNumber(yPos + 1);
+        mOutput.Append(';');
+        mOutput.AppendNumber(xPos + 1);
+        mOutput.Append('H');
+        break;
+    case MOVE_RELATIVE:
+        mOutput.Append("\033[", 2);
+        if (xPos - mCursorX != 1 && mCursorX - xPos != 1) {
+            mOutput.AppendNumber((unsigned)((xPos > mCursorX) ? xPos - mCursorX : mCursorX - xPos));
+        }
+        mOutput.Append((xPos > mCursorX) ? 'C' : 'D');
+        break;
+    case MOVE_REWRITE:
+        for (int x = mCursorX; x < xPos; ++x) {
+            AppendGlyph(presentBuffer[yPos * mWidth + x].glyph);
+        }
+        break;
+    case MOVE_NEWLINE:
+        if (yPos == mCursorY) {
+            mOutput.Append('\r');
+        }
+        for (int y = mCursorY; y < yPos; ++y) {
+            mOutput.Append("\r\n", 2);
+        }
+        mCursorX = 0;
+        mCursorY = yPos;
+        bestCost = RewriteCost(yPos, 0, xPos);
+        if (bestCost >= 0 && bestCost < ColumnMoveCost(xPos)) {
+            for (int x = 0; x < xPos; ++x) {
+                AppendGlyph(presentBuffer[yPos * mWidth + x].glyph);
+            }
+        }
+        else if (xPos > 0) {
+            mOutput.Append("\033[", 2);
+            if (xPos != 1) {
+                mOutput.AppendNumber((unsigned)xPos);
+            }
+            mOutput.Append('C');
+        }
+        break;
+    }
+    mCursorX = xPos;
+    mCursorY = yPos;
+} // END MoveCursor
 
+/****************************************************************************
+Function: Present
+Parameter(s): N/A
+Output: N/A
+Comments: Diffs the back buffer against the present buffer and writes only
+          the changed cells to the terminal.  Cells are visited in row-major
+          order so neighbouring changes go out as one run, and the cursor
+          only moves when there is a gap.  Colours are only sent when they
+          differ from what the terminal is already drawing with.  The whole
+          frame is collected in the output arena and written with a single
+          call.
+****************************************************************************/
 void RenderEngine::Present() {
+    TRACE_SCOPE("RenderEngine::Present");
+    int cellsWritten = 0;
+    for (int i = 0; i < mBufferSize; ++i) {
+        if (backBuffer[i] == presentBuffer[i]) {
+            continue;
+        }
+
+        const ScreenCell &cell = backBuffer[i];
+        MoveCursor(i % mWidth, i / mWidth);
+        mAttributeState.Apply(cell.attribute, mOutput);
+        AppendGlyph(cell.glyph);
+        presentBuffer[i] = cell;
+        cellsWritten++;
+    }
 
-}
\ No newline at end of file
+    mLastPresentBytes = mOutput.Flush();
+    Metrics::Increment(COUNTER_FRAMES_PRESENTED);
+    Metrics::Increment(COUNTER_RENDER_CELLS, cellsWritten);
+    Metrics::Increment(COUNTER_RENDER_BYTES, mLastPresentBytes);
+    Metrics::SetGauge(GAUGE_FRAME_CELLS, cellsWritten);
+    Metrics::SetGauge(GAUGE_FRAME_BYTES, (long long)mLastPresentBytes);
+} // END Present
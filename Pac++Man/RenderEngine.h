@@ -1,37 +1,80 @@
 #ifndef _RENDER_ENGINE_H_
 #define _RENDER_ENGINE_H_
 
+#include "AttributeState.h"
 #include "Entity.h"
+#include "FrameOutputBuffer.h"
+#include <vector>
 
+/****************************************************************************
+Struct: ScreenCell
+Comments: One character position on screen.  The attribute uses the Win32
+          console layout (See @Constants.h TEXT_ATTRIBUTES): low nibble is
+          the foreground colour, high nibble the background colour.
+****************************************************************************/
+struct ScreenCell {
+    char glyph;
+    unsigned char attribute;
+
+    bool operator==(const ScreenCell &other) const { return glyph == other.glyph && attribute == other.attribute; }
+    bool operator!=(const ScreenCell &other) const { return !(*this == other); }
+};
+
+/****************************************************************************
+Class: RenderEngine
+Comments: Double-buffered character framebuffer.  Everything on screen is
+          drawn into the back buffer; Present() compares it against the
+          present buffer (what the terminal currently shows) and writes out
+          only the cells that differ.  Owned by whoever drives the frame
+          loop.  There is deliberately no global instance, so any number of
+          games can exist side by side.
+****************************************************************************/
 class RenderEngine {
 private:
-    char *presentBuffer, *backBuffer;
-    int mBufferSize;
-    RenderEngine(const RenderEngine &other) { }
-    RenderEngine &operator=(const RenderEngine &other) { }
-    RenderEngine() : presentBuffer(nullptr), backBuffer(nullptr) { }
+    // Worst case terminal bytes for one cell: cursor move, colours, glyph
+    const static int MAX_BYTES_PER_CELL = 32;
+    // Longest gap the cursor planner will consider re-writing glyphs over
+    const static int MAX_REWRITE_GAP = 8;
 
-    virtual ~RenderEngine() {
-        if (presentBuffer != nullptr) {
-            delete[] presentBuffer;
-            presentBuffer = nullptr;
-        }
-        if (backBuffer != nullptr) {
-            delete[] backBuffer;
-            backBuffer = nullptr;
-        }
-    }
+    ScreenCell *presentBuffer, *backBuffer;
+    int mBufferSize, mWidth, mHeight;
+    int mCursorX, mCursorY;
+    size_t mLastPresentBytes;
+    std::vector<Entity *> mTrackedEntities;
+    FrameOutputBuffer mOutput;
+    AttributeState mAttributeState;
+    RenderEngine(const RenderEngine &other);
+    RenderEngine &operator=(const RenderEngine &other);
+
+    void ReleaseBuffers();
+    void AppendGlyph(char glyph);
+    void MoveCursor(int xPos, int yPos);
+    int RewriteCost(int yPos, int fromX, int toX);
 
 public:
-    static RenderEngine &GetInstance() {
-        static RenderEngine instance;
-        return instance;
+    RenderEngine() : presentBuffer(nullptr), backBuffer(nullptr), mBufferSize(0), mWidth(0), mHeight(0), mCursorX(-1), mCursorY(-1), mLastPresentBytes(0) { }
+
+    virtual ~RenderEngine() {
+        ReleaseBuffers();
     }
 
-    void InitializeEngine(int bufferSize = 0);
+    static unsigned char AttributeFromAnsi(int foreColor, int backColor, bool bright = true);
+
+    int getWidth() { return mWidth; }
+    int getHeight() { return mHeight; }
+    size_t getLastPresentBytes() { return mLastPresentBytes; }
+
+    void InitializeEngine(int width = SCREEN_BUFFER_WIDTH, int height = SCREEN_BUFFER_HEIGHT);
     void AddEntity(Entity &entity);
+    void RemoveAllEntities() { mTrackedEntities.clear(); }
+    void RenderEntities();
+
+    void DrawCharacter(int xPos, int yPos, char glyph, unsigned char attribute);
+    void DrawCells(int xPos, int yPos, const ScreenCell *cells, int count);
+    void DrawString(int xPos, int yPos, const char *text, unsigned char attribute);
 
     void PrepareBuffer();
+    void InvalidateScreen();
     void Present();
 };
 
@@ -0,0 +1,183 @@
+/****************************************************************************
+File: Replay.cpp
+Author: fookenCode
+****************************************************************************/
+#include "Replay.h"
+#include <cstdio>
+#include <cstring>
+
+const static char REPLAY_MAGIC[4] = { 'P', 'A', 'C', 'R' };
+
+/****************************************************************************
+Function: AppendVarint
+Parameter(s): std::vector<unsigned char> & - Bytes to append to
+              unsigned - Value to encode
+Output: N/A
+Comments: Seven bits per byte, low bits first, top bit set on every byte
+          but the last.
+****************************************************************************/
+static void AppendVarint(std::vector<unsigned char> &bytes, unsigned value) {
+    while (value >= 0x80) {
+        bytes.push_back((unsigned char)(value | 0x80));
+        value >>= 7;
+    }
+    bytes.push_back((unsigned char)value);
+} // END AppendVarint
+
+/****************************************************************************
+Function: ReadVarint
+Parameter(s): const std::vector<unsigned char> & - Bytes to read from
+              size_t & - Read position, advanced past the value
+              unsigned & - Receives the value
+Output: bool - False if the bytes end mid-value or it overflows 32 bits.
+Comments: N/A
+****************************************************************************/
+static bool ReadVarint(const std::vector<unsigned char> &bytes, size_t &position, unsigned &value) {
+    value = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        if (position >= bytes.size()) {
+            return false;
+        }
+        unsigned char byte = bytes[position++];
+        if (shift == 28 && (byte & 0x70) != 0) {
+            return false;
+        }
+        value |= (unsigned)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+} // END ReadVarint
+
+/****************************************************************************
+Function: ReplayRecorder
+Parameter(s): InputSource * - Source whose inputs are recorded
+              int - Level the session starts on
+              unsigned - Seed the session was started with
+Output: N/A
+Comments: Constructor
+****************************************************************************/
+ReplayRecorder::ReplayRecorder(InputSource *source, int startLevel, unsigned seed)
+    : mSource(source), mStartLevel(startLevel), mSeed(seed), mLastTick(0), mLastChangeTick(0), mLastInputBits(0) {
+} // END ReplayRecorder
+
+/****************************************************************************
+Function: PollInput
+Parameter(s): unsigned - Current simulation tick
+Output: unsigned - The wrapped source's inputs for the tick.
+Comments: N/A
+****************************************************************************/
+unsigned ReplayRecorder::PollInput(unsigned tick) {
+    unsigned inputBits = mSource->PollInput(tick);
+    unsigned recordedBits = inputBits & REPLAY_INPUT_MASK;
+    if (recordedBits != mLastInputBits) {
+        AppendVarint(mChanges, tick - mLastChangeTick);
+        AppendVarint(mChanges, recordedBits);
+        mLastChangeTick = tick;
+        mLastInputBits = recordedBits;
+    }
+    mLastTick = tick;
+    return inputBits;
+} // END PollInput
+
+/****************************************************************************
+Function: Save
+Parameter(s): const char * - Path of the replay to write
+Output: bool - Whether the replay was written.
+Comments: N/A
+****************************************************************************/
+bool ReplayRecorder::Save(const char *filename) {
+    std::vector<unsigned char> header(REPLAY_MAGIC, REPLAY_MAGIC + sizeof(REPLAY_MAGIC));
+    AppendVarint(header, REPLAY_FORMAT_VERSION);
+    AppendVarint(header, (unsigned)mStartLevel);
+    AppendVarint(header, mSeed);
+    AppendVarint(header, mLastTick);
+
+    FILE *output = fopen(filename, "wb");
+    if (output == nullptr) {
+        return false;
+    }
+    bool written = fwrite(header.data(), 1, header.size(), output) == header.size() &&
+                   (mChanges.empty() || fwrite(mChanges.data(), 1, mChanges.size(), output) == mChanges.size());
+    return (fclose(output) == 0) && written;
+} // END Save
+
+/****************************************************************************
+Function: ReplayInput
+Parameter(s): N/A
+Output: N/A
+Comments: Constructor
+****************************************************************************/
+ReplayInput::ReplayInput()
+    : mReadPosition(0), mStartLevel(1), mSeed(0), mTickCount(0), mNextChangeTick(0), mNextInputBits(0), mInputBits(0), mHasNextChange(false) {
+} // END ReplayInput
+
+/****************************************************************************
+Function: Load
+Parameter(s): const char * - Path of the replay to read
+Output: bool - Whether the replay was read; errors go to stderr.
+Comments: The header is checked here; the changes are decoded as play
+          reaches them.
+****************************************************************************/
+bool ReplayInput::Load(const char *filename) {
+    FILE *input = fopen(filename, "rb");
+    if (input == nullptr) {
+        fprintf(stderr, "%s: cannot open\n", filename);
+        return false;
+    }
+    mData.clear();
+    unsigned char buffer[4096];
+    size_t bytesRead;
+    while ((bytesRead = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+        mData.insert(mData.end(), buffer, buffer + bytesRead);
+    }
+    fclose(input);
+
+    unsigned version = 0, startLevel = 0;
+    mReadPosition = sizeof(REPLAY_MAGIC);
+    if (mData.size() < sizeof(REPLAY_MAGIC) || memcmp(mData.data(), REPLAY_MAGIC, sizeof(REPLAY_MAGIC)) != 0) {
+        fprintf(stderr, "%s: not a replay\n", filename);
+        return false;
+    }
+    if (!ReadVarint(mData, mReadPosition, version) || version != REPLAY_FORMAT_VERSION) {
+        fprintf(stderr, "%s: replay version %u, expected %u\n", filename, version, REPLAY_FORMAT_VERSION);
+        return false;
+    }
+    if (!ReadVarint(mData, mReadPosition, startLevel) || !ReadVarint(mData, mReadPosition, mSeed) ||
+        !ReadVarint(mData, mReadPosition, mTickCount) || startLevel < 1 || startLevel > MAX_LEVEL_NUMBER) {
+        fprintf(stderr, "%s: bad replay header\n", filename);
+        return false;
+    }
+    mStartLevel = (int)startLevel;
+    mInputBits = 0;
+    mNextChangeTick = 0;
+    ReadNextChange();
+    return true;
+} // END Load
+
+/****************************************************************************
+Function: ReadNextChange
+Parameter(s): N/A
+Output: N/A
+Comments: A truncated or corrupt change ends the replay there.
+****************************************************************************/
+void ReplayInput::ReadNextChange() {
+    unsigned tickDelta = 0;
+    mHasNextChange = ReadVarint(mData, mReadPosition, tickDelta) && ReadVarint(mData, mReadPosition, mNextInputBits);
+    mNextChangeTick += tickDelta;
+} // END ReadNextChange
+
+/****************************************************************************
+Function: PollInput
+Parameter(s): unsigned - Current simulation tick
+Output: unsigned - Inputs recorded for the tick.
+Comments: Ticks must be polled in increasing order, as PacGame::Step does.
+****************************************************************************/
+unsigned ReplayInput::PollInput(unsigned tick) {
+    while (mHasNextChange && mNextChangeTick <= tick) {
+        mInputBits = mNextInputBits;
+        ReadNextChange();
+    }
+    return mInputBits;
+} // END PollInput
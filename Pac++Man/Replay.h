@@ -0,0 +1,69 @@
+/****************************************************************************
+File: Replay.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _REPLAY_H_
+#define _REPLAY_H_
+
+#include "InputSource.h"
+#include <cstddef>
+#include <vector>
+
+/****************************************************************************
+Comments: A replay is the input of one session, enough to re-run it tick
+          for tick, since the simulation only advances on Step() and reads
+          nothing but its InputSource.  Layout, all numbers unsigned LEB128
+          varints:
+            "PACR" FORMAT_VERSION startLevel seed tickCount
+            { ticksSincePreviousChange inputBits } ... until end of file
+          Only ticks where the inputs change are stored, so a held key costs
+          nothing and a whole game is typically a few kilobytes.  The seed
+          is the game's PacGame::setRandomSeed.
+****************************************************************************/
+const static unsigned REPLAY_FORMAT_VERSION = 1;
+// Inputs the simulation acts on; the profiler and trace keys are not kept
+const static unsigned REPLAY_INPUT_MASK = INPUT_LEFT_BIT | INPUT_RIGHT_BIT | INPUT_UP_BIT | INPUT_DOWN_BIT |
+                                          INPUT_PAUSE_BIT | INPUT_COIN_BIT | INPUT_START_BIT | INPUT_QUIT_BIT |
+                                          INPUT_FOCUS_LOST_BIT;
+
+/****************************************************************************
+Class: ReplayRecorder
+Comments: Passes another InputSource through unchanged while recording it.
+****************************************************************************/
+class ReplayRecorder : public InputSource {
+private:
+    InputSource *mSource;
+    int mStartLevel;
+    unsigned mSeed, mLastTick, mLastChangeTick, mLastInputBits;
+    std::vector<unsigned char> mChanges;
+public:
+    ReplayRecorder(InputSource *source, int startLevel, unsigned seed);
+    virtual unsigned PollInput(unsigned tick);
+
+    unsigned getTickCount() { return mLastTick; }
+    bool Save(const char *filename);
+};
+
+/****************************************************************************
+Class: ReplayInput
+Comments: Feeds a recorded replay back, answering each tick with the
+          inputs recorded for it.  Past the end nothing is pressed.
+****************************************************************************/
+class ReplayInput : public InputSource {
+private:
+    std::vector<unsigned char> mData;
+    size_t mReadPosition;
+    int mStartLevel;
+    unsigned mSeed, mTickCount, mNextChangeTick, mNextInputBits, mInputBits;
+    bool mHasNextChange;
+    void ReadNextChange();
+public:
+    ReplayInput();
+    bool Load(const char *filename);
+    virtual unsigned PollInput(unsigned tick);
+
+    int getStartLevel() { return mStartLevel; }
+    unsigned getSeed() { return mSeed; }
+    unsigned getTickCount() { return mTickCount; }
+};
+#endif // _REPLAY_H_
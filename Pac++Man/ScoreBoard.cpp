@@ -1,8 +1,7 @@
 #include "ScoreBoard.h"
-#include <Windows.h>
-#include <iostream>
-ScoreBoard::ScoreBoard() :scoreTotal(0L){
-    setInvalidated(true);
+#include "RenderEngine.h"
+#include <cstdio>
+ScoreBoard::ScoreBoard() :scoreTotal(0L) {
 }
 
 ScoreBoard::~ScoreBoard() {
@@ -11,23 +10,17 @@ ScoreBoard::~ScoreBoard() {
 
 /****************************************************************************
 Function: Render
-Parameter(s): N/A
+Parameter(s): RenderEngine & - Engine whose back buffer is drawn into.
 Output: N/A
-Comments: Renders the Score information on the right-side of screen.
+Comments: Renders the Score information on the right-side of screen.  The
+          value is padded to a fixed width so a smaller score fully
+          replaces a larger one.
 ****************************************************************************/
-void ScoreBoard::Render() {
-    if (isInvalidated) {
-        COORD Position;
-        Position.X = (int)xPos;
-        Position.Y = (int)yPos;
-        SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), Position);
-        std::cout << "\033[40;37;1m" << SCORE_NAME_TEXT;
-        Position.Y += 1;
-        SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), Position);
-        std::cout << "\033[33;1m" << scoreTotal << "\033[0m";
-        
-        setInvalidated(false);
-    }
+void ScoreBoard::Render(RenderEngine &engine) {
+    char scoreText[32];
+    snprintf(scoreText, sizeof(scoreText), "%-*ld", BOARD_VALUE_WIDTH, scoreTotal);
+    engine.DrawString((int)xPos, (int)yPos, SCORE_NAME_TEXT, ATTR_BOARD_TEXT);
+    engine.DrawString((int)xPos, (int)yPos + 1, scoreText, ATTR_HIGHLIGHT_TEXT);
 } // END Render
 
 /****************************************************************************
@@ -38,10 +31,4 @@ Comments: Resets the internal score to Zero for next game.
 ****************************************************************************/
 void ScoreBoard::Reset() {
     this->scoreTotal = 0L;
-    COORD Position;
-    Position.X = (int)xPos;
-    Position.Y = (int)yPos+1;
-    SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), Position);
-    std::cout << CLEAR_STATUS_TEXT;
-    setInvalidated(true);
-} // END Reset
\ No newline at end of file
+} // END Reset
@@ -0,0 +1,85 @@
+/****************************************************************************
+File: StockLevels.h
+Author: fookenCode
+Comments: Generated from the text levels by "--embed-levels", do not edit.
+****************************************************************************/
+#ifndef _STOCK_LEVELS_H_
+#define _STOCK_LEVELS_H_
+
+#include "EmbeddedLevels.h"
+
+constexpr unsigned char STOCK_LEVEL_1_TILES[36 * 30] = {
+    0xC9, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xBB, 0x61, 0xC9, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xBB,
+    0xBA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x61, 0xBA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF9, 0xBA,
+    0xBA, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xBA, 0x61, 0xBA, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xBA, 0x61, 0xBA, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xC8, 0xCD, 0xBC, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xDA, 0xC4, 0xBF, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xDA, 0xC4, 0xBF, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xBF, 0x61, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xBA,
+    0xBA, 0xF9, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xC0, 0xC4, 0xC4, 0xC4, 0xBF, 0x20, 0xB3, 0x61, 0xB3, 0x20, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA,
+    0xC8, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xFA, 0xB3, 0x61, 0xDA, 0xC4, 0xC4, 0xC4, 0xD9, 0x20, 0xC0, 0xC4, 0xD9, 0x20, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0x61, 0xB3, 0xFA, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xBC,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xFA, 0xB3, 0x61, 0xB3, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xB3, 0x61, 0xB3, 0xFA, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xBB, 0xFA, 0xB3, 0x61, 0xB3, 0x20, 0xDA, 0xC4, 0xC4, 0xC4, 0x7E, 0x7E, 0x7E, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0x20, 0xB3, 0x61, 0xB3, 0xFA, 0xC9, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xBA, 0xFA, 0xC0, 0xC4, 0xD9, 0x20, 0xB3, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xB3, 0x20, 0xC0, 0xC4, 0xD9, 0xFA, 0xBA, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xBA, 0xFA, 0x20, 0x20, 0x20, 0x20, 0xB3, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xB3, 0x20, 0x20, 0x20, 0x20, 0xFA, 0xBA, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0xC9, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xBC, 0xFA, 0xDA, 0xC4, 0xBF, 0x20, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0x20, 0xDA, 0xC4, 0xBF, 0xFA, 0xC8, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xBB,
+    0xBA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xB3, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xB3, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xB3, 0x61, 0xB3, 0x20, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0x20, 0xB3, 0x61, 0xB3, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xC0, 0xC4, 0xD9, 0x20, 0xC0, 0xC4, 0xC4, 0xC4, 0xBF, 0x61, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0x20, 0xC0, 0xC4, 0xD9, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xC0, 0xC4, 0xBF, 0x61, 0xB3, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xC0, 0xC4, 0xD9, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xB3, 0x61, 0xDA, 0xC4, 0xD9, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0x20, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xFA, 0xF9, 0xBA,
+    0xC8, 0xCD, 0xBB, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xDA, 0xC4, 0xBF, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xDA, 0xC4, 0xBF, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xC9, 0xCD, 0xBC,
+    0xC9, 0xCD, 0xBC, 0xFA, 0xC0, 0xC4, 0xD9, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xBF, 0x61, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xC0, 0xC4, 0xD9, 0xFA, 0xC8, 0xCD, 0xBB,
+    0xBA, 0xF9, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0x61, 0xC0, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0x61, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xC0, 0xC4, 0xD9, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA,
+    0xC8, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xBC,
+};
+constexpr EmbeddedLevel<36, 30> STOCK_LEVEL_1 = MakeEmbeddedLevel<36, 30>(STOCK_LEVEL_1_TILES, 32, 44);
+static_assert(STOCK_LEVEL_1.totalDots == 297, "Level 1 pellet count differs from the text level");
+
+constexpr unsigned char STOCK_LEVEL_2_TILES[36 * 30] = {
+    0xC9, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xBB, 0x61, 0xC9, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xBB,
+    0xBA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x61, 0xBA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF9, 0xBA,
+    0xBA, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xBA, 0x61, 0xBA, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xBA, 0x61, 0xBA, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xC8, 0xCD, 0xBC, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xDA, 0xC4, 0xBF, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xDA, 0xC4, 0xBF, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xBF, 0x61, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xBA,
+    0xBA, 0xF9, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xC0, 0xC4, 0xC4, 0xC4, 0xBF, 0x20, 0xB3, 0x61, 0xB3, 0x20, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA,
+    0xC8, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xFA, 0xB3, 0x61, 0xDA, 0xC4, 0xC4, 0xC4, 0xD9, 0x20, 0xC0, 0xC4, 0xD9, 0x20, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0x61, 0xB3, 0xFA, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xBC,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xFA, 0xB3, 0x61, 0xB3, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xB3, 0x61, 0xB3, 0xFA, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xBB, 0xFA, 0xB3, 0x61, 0xB3, 0x20, 0xDA, 0xC4, 0xC4, 0xC4, 0x7E, 0x7E, 0x7E, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0x20, 0xB3, 0x61, 0xB3, 0xFA, 0xC9, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xBA, 0xFA, 0xC0, 0xC4, 0xD9, 0x20, 0xB3, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xB3, 0x20, 0xC0, 0xC4, 0xD9, 0xFA, 0xBA, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xBA, 0xFA, 0x20, 0x20, 0x20, 0x20, 0xB3, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xB3, 0x20, 0x20, 0x20, 0x20, 0xFA, 0xBA, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0xC9, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xBC, 0xFA, 0xDA, 0xC4, 0xBF, 0x20, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0x20, 0xDA, 0xC4, 0xBF, 0xFA, 0xC8, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xBB,
+    0xBA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xB3, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xB3, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xB3, 0x61, 0xB3, 0x20, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0x20, 0xB3, 0x61, 0xB3, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xC0, 0xC4, 0xD9, 0x20, 0xC0, 0xC4, 0xC4, 0xC4, 0xBF, 0x61, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0x20, 0xC0, 0xC4, 0xD9, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xB3, 0x61, 0x61, 0x61, 0xB3, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xC0, 0xC4, 0xBF, 0x61, 0xB3, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xC0, 0xC4, 0xD9, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xB3, 0x61, 0xDA, 0xC4, 0xD9, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0x20, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xFA, 0xF9, 0xBA,
+    0xC8, 0xCD, 0xBB, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xDA, 0xC4, 0xBF, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xDA, 0xC4, 0xBF, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xC9, 0xCD, 0xBC,
+    0xC9, 0xCD, 0xBC, 0xFA, 0xC0, 0xC4, 0xD9, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xBF, 0x61, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xC0, 0xC4, 0xD9, 0xFA, 0xC8, 0xCD, 0xBB,
+    0xBA, 0xF9, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0x61, 0xC0, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xB3, 0x61, 0xB3, 0xFA, 0xDA, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0x61, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xBF, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xC0, 0xC4, 0xD9, 0xFA, 0xC0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xD9, 0xFA, 0xBA,
+    0xBA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA,
+    0xC8, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xBC,
+};
+constexpr EmbeddedLevel<36, 30> STOCK_LEVEL_2 = MakeEmbeddedLevel<36, 30>(STOCK_LEVEL_2_TILES, 33, 44);
+static_assert(STOCK_LEVEL_2.totalDots == 297, "Level 2 pellet count differs from the text level");
+
+static const EmbeddedLevelView STOCK_LEVELS[] = {
+    MakeEmbeddedLevelView(1, STOCK_LEVEL_1),
+    MakeEmbeddedLevelView(2, STOCK_LEVEL_2),
+};
+#endif // _STOCK_LEVELS_H_
@@ -0,0 +1,62 @@
+/****************************************************************************
+File: TileClass.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _TILE_CLASS_H_
+#define _TILE_CLASS_H_
+
+#include "Constants.h"
+#include <cstddef>
+#include <utility>
+
+enum TILE_CLASSES {
+    TILE_INNER_WALL     = 0x01,
+    TILE_OUTER_WALL     = 0x02,
+    TILE_PELLET         = 0x04,
+    TILE_POWER_PELLET   = 0x08,
+    TILE_WALKABLE       = 0x10,
+    TILE_FILLER         = 0x20,
+    TILE_SPAWN_BARRIER  = 0x40,
+    TILE_ANY_WALL       = TILE_INNER_WALL | TILE_OUTER_WALL,
+    TILE_ANY_PELLET     = TILE_PELLET | TILE_POWER_PELLET
+};
+
+/****************************************************************************
+Function: ClassifyTile
+Parameter(s): char - Map character
+Output: unsigned char - TILE_CLASSES flags for the character.
+Comments: Only evaluated at compile time to fill TILE_CLASS_TABLE.
+****************************************************************************/
+constexpr unsigned char ClassifyTile(char tile) {
+    return (tile == INNER_WALL_HORIZONTAL_CHARACTER || tile == INNER_WALL_VERTICAL_CHARACTER ||
+            tile == INNER_WALL_TOP_LEFT_CHARACTER || tile == INNER_WALL_TOP_RIGHT_CHARACTER ||
+            tile == INNER_WALL_BOTTOM_LEFT_CHARACTER || tile == INNER_WALL_BOTTOM_RIGHT_CHARACTER) ? TILE_INNER_WALL :
+           (tile == OUTER_WALL_HORIZONTAL_CHARACTER || tile == OUTER_WALL_VERTICAL_CHARACTER ||
+            tile == OUTER_WALL_TOP_LEFT_CHARACTER || tile == OUTER_WALL_TOP_RIGHT_CHARACTER ||
+            tile == OUTER_WALL_BOTTOM_LEFT_CHARACTER || tile == OUTER_WALL_BOTTOM_RIGHT_CHARACTER) ? TILE_OUTER_WALL :
+           (tile == NORML_PELLET_CHARACTER) ? (TILE_PELLET | TILE_WALKABLE) :
+           (tile == POWER_PELLET_CHARACTER) ? (TILE_POWER_PELLET | TILE_WALKABLE) :
+           (tile == ' ') ? TILE_WALKABLE :
+           (tile == MAP_FILLER_CHARACTER) ? TILE_FILLER :
+           (tile == SPAWN_BOX_BARRIER_CHARACTER) ? TILE_SPAWN_BARRIER : 0;
+} // END ClassifyTile
+
+struct TileClassTable {
+    unsigned char flags[256];
+};
+
+template <size_t... Index>
+constexpr TileClassTable MakeTileClassTable(std::index_sequence<Index...>) {
+    return TileClassTable{ { ClassifyTile((char)Index)... } };
+} // END MakeTileClassTable
+
+// Flags for every possible map byte, indexed by (unsigned char)character
+constexpr TileClassTable TILE_CLASS_TABLE = MakeTileClassTable(std::make_index_sequence<256>());
+
+static_assert(TILE_CLASS_TABLE.flags[0xC4] == TILE_INNER_WALL, "Inner wall missing from TILE_CLASS_TABLE");
+static_assert(TILE_CLASS_TABLE.flags[0xCD] == TILE_OUTER_WALL, "Outer wall missing from TILE_CLASS_TABLE");
+static_assert(TILE_CLASS_TABLE.flags[0xFA] == (TILE_PELLET | TILE_WALKABLE), "Pellet missing from TILE_CLASS_TABLE");
+
+inline unsigned char GetTileClass(char tile) { return TILE_CLASS_TABLE.flags[(unsigned char)tile]; }
+inline bool TileHasClass(char tile, unsigned tileClasses) { return (GetTileClass(tile) & tileClasses) != 0; }
+#endif // _TILE_CLASS_H_
@@ -0,0 +1,124 @@
+/****************************************************************************
+File: TraceRecorder.cpp
+Author: fookenCode
+****************************************************************************/
+#include "TraceRecorder.h"
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+std::atomic<bool> TraceRecorder::sEnabled(false);
+
+namespace {
+struct ThreadBuffer {
+    int threadId;
+    // Total spans ever recorded; the slot written next is head % BUFFER_EVENTS
+    std::atomic<unsigned long long> head;
+    std::vector<TraceRecorder::Event> events;
+
+    explicit ThreadBuffer(int threadId) : threadId(threadId), head(0), events(TraceRecorder::BUFFER_EVENTS) { }
+};
+
+// Every buffer ever registered, kept until exit so spans outlive their thread
+struct TraceRegistry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer> > buffers;
+};
+
+TraceRegistry &GetRegistry() {
+    static TraceRegistry registry;
+    return registry;
+}
+
+const std::chrono::steady_clock::time_point TRACE_EPOCH = std::chrono::steady_clock::now();
+thread_local ThreadBuffer *tThreadBuffer = nullptr;
+}
+
+/****************************************************************************
+Function: Now
+Parameter(s): N/A
+Output: long long - Nanoseconds since start-up.
+Comments: N/A
+****************************************************************************/
+long long TraceRecorder::Now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - TRACE_EPOCH).count();
+} // END Now
+
+/****************************************************************************
+Function: Record
+Parameter(s): const char * - Span name
+              long long - Start, from Now()
+              long long - Duration in nanoseconds
+Output: N/A
+Comments: Called by ~TraceScope on the thread that ran the span.
+****************************************************************************/
+void TraceRecorder::Record(const char *name, long long start, long long duration) {
+    ThreadBuffer *buffer = tThreadBuffer;
+    if (buffer == nullptr) {
+        TraceRegistry &registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.buffers.push_back(std::unique_ptr<ThreadBuffer>(new ThreadBuffer((int)registry.buffers.size() + 1)));
+        buffer = tThreadBuffer = registry.buffers.back().get();
+    }
+
+    unsigned long long head = buffer->head.load(std::memory_order_relaxed);
+    Event &event = buffer->events[head % BUFFER_EVENTS];
+    event.name = name;
+    event.start = start;
+    event.duration = duration;
+    buffer->head.store(head + 1, std::memory_order_release);
+} // END Record
+
+/****************************************************************************
+Function: getEventCount
+Parameter(s): N/A
+Output: size_t - Spans currently held, over all threads.
+Comments: N/A
+****************************************************************************/
+size_t TraceRecorder::getEventCount() {
+    TraceRegistry &registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    size_t count = 0;
+    for (size_t i = 0; i < registry.buffers.size(); ++i) {
+        unsigned long long head = registry.buffers[i]->head.load(std::memory_order_acquire);
+        count += (size_t)((head < (unsigned long long)BUFFER_EVENTS) ? head : BUFFER_EVENTS);
+    }
+    return count;
+} // END getEventCount
+
+/****************************************************************************
+Function: WriteChromeTrace
+Parameter(s): const char * - Path of the JSON file to write
+Output: bool - Whether the file was written.
+Comments: Every span is a complete ("X") event, timestamps in microseconds;
+          each recording thread shows up as its own track.
+****************************************************************************/
+bool TraceRecorder::WriteChromeTrace(const char *filename) {
+    FILE *output = fopen(filename, "w");
+    if (output == nullptr) {
+        return false;
+    }
+
+    TraceRegistry &registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    fprintf(output, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    bool first = true;
+    for (size_t i = 0; i < registry.buffers.size(); ++i) {
+        const ThreadBuffer &buffer = *registry.buffers[i];
+        fprintf(output, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"Thread %d\"}}",
+                first ? "" : ",", buffer.threadId, buffer.threadId);
+        first = false;
+
+        unsigned long long head = buffer.head.load(std::memory_order_acquire);
+        unsigned long long oldest = (head > (unsigned long long)BUFFER_EVENTS) ? head - BUFFER_EVENTS : 0;
+        for (unsigned long long j = oldest; j < head; ++j) {
+            const Event &event = buffer.events[j % BUFFER_EVENTS];
+            fprintf(output, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                    event.name, buffer.threadId, event.start / 1000.0, event.duration / 1000.0);
+        }
+    }
+    fprintf(output, "\n]}\n");
+    return fclose(output) == 0;
+} // END WriteChromeTrace
@@ -0,0 +1,80 @@
+/****************************************************************************
+File: TraceRecorder.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _TRACE_RECORDER_H_
+#define _TRACE_RECORDER_H_
+
+#include <atomic>
+#include <cstddef>
+
+/****************************************************************************
+Class: TraceRecorder
+Comments: Records TRACE_SCOPE spans into a ring buffer owned by the thread
+          that ran them, exported as Chrome trace JSON (load it in
+          chrome://tracing or ui.perfetto.dev).  Only the owning thread
+          writes a buffer, so recording takes no locks: it fills the next
+          slot and publishes it by advancing the buffer's head.  A thread's
+          buffer is registered, under a mutex, the first time it records.
+          When full, the oldest spans are overwritten.
+
+          Off until SetEnabled(true); while off a span is one relaxed load.
+          Export once the traced threads are idle or joined, otherwise the
+          spans being written at that moment may come out torn.  Building
+          with PACMAN_DISABLE_TRACING removes the spans altogether.
+****************************************************************************/
+class TraceRecorder {
+public:
+    // Per thread; 24 bytes each
+    const static int BUFFER_EVENTS = 1 << 16;
+
+    struct Event {
+        const char *name;
+        long long start, duration;
+    };
+private:
+    static std::atomic<bool> sEnabled;
+public:
+    static bool IsEnabled() { return sEnabled.load(std::memory_order_relaxed); }
+    static void SetEnabled(bool enabled) { sEnabled.store(enabled, std::memory_order_relaxed); }
+
+    static long long Now();
+    static void Record(const char *name, long long start, long long duration);
+
+    static size_t getEventCount();
+    static bool WriteChromeTrace(const char *filename);
+};
+
+/****************************************************************************
+Class: TraceScope
+Comments: One span, from construction to the end of the enclosing scope.
+          The name must be a string literal, only the pointer is kept.
+****************************************************************************/
+class TraceScope {
+private:
+    const char *mName;
+    long long mStart;
+    TraceScope(const TraceScope &other);
+    TraceScope &operator=(const TraceScope &other);
+public:
+    explicit TraceScope(const char *name) : mName(nullptr), mStart(0) {
+        if (TraceRecorder::IsEnabled()) {
+            mName = name;
+            mStart = TraceRecorder::Now();
+        }
+    }
+    ~TraceScope() {
+        if (mName != nullptr) {
+            TraceRecorder::Record(mName, mStart, TraceRecorder::Now() - mStart);
+        }
+    }
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#ifdef PACMAN_DISABLE_TRACING
+#define TRACE_SCOPE(name)
+#else
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope, __LINE__)(name)
+#endif
+#endif // _TRACE_RECORDER_H_
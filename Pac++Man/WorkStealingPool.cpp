@@ -0,0 +1,99 @@
+/****************************************************************************
+File: WorkStealingPool.cpp
+Author: fookenCode
+****************************************************************************/
+#include "WorkStealingPool.h"
+#include <thread>
+
+WorkStealingPool::WorkStealingPool(unsigned workerCount) : mWorkerCount(workerCount), mNextQueue(0) {
+    if (mWorkerCount == 0) {
+        mWorkerCount = std::thread::hardware_concurrency();
+    }
+    if (mWorkerCount == 0) {
+        mWorkerCount = 1;
+    }
+    mQueues = std::vector<WorkerQueue>(mWorkerCount);
+}
+
+/****************************************************************************
+Function: Submit
+Parameter(s): const Job & - Job to run on one of the workers.
+Output: N/A
+Comments: Jobs are dealt round-robin over the worker queues.  Must not be
+          called while RunToCompletion is in progress.
+****************************************************************************/
+void WorkStealingPool::Submit(const Job &job) {
+    mQueues[mNextQueue].jobs.push_back(job);
+    mNextQueue = (mNextQueue + 1) % mWorkerCount;
+} // END Submit
+
+/****************************************************************************
+Function: PopLocal
+Parameter(s): unsigned - Index of the worker popping work.
+              Job & - Receives the job when one is available.
+Output: bool - True if a job was taken from the worker's own queue.
+Comments: Owners work LIFO from the back of their queue.
+****************************************************************************/
+bool WorkStealingPool::PopLocal(unsigned workerIndex, Job &job) {
+    WorkerQueue &queue = mQueues[workerIndex];
+    std::lock_guard<std::mutex> guard(queue.lock);
+    if (queue.jobs.empty()) {
+        return false;
+    }
+    job = std::move(queue.jobs.back());
+    queue.jobs.pop_back();
+    return true;
+} // END PopLocal
+
+/****************************************************************************
+Function: Steal
+Parameter(s): unsigned - Index of the worker looking for work.
+              Job & - Receives the stolen job.
+Output: bool - True if a job was stolen from another worker.
+Comments: Thieves take FIFO from the front of their victim's queue, which
+          keeps them away from the end the owner is working on.
+****************************************************************************/
+bool WorkStealingPool::Steal(unsigned workerIndex, Job &job) {
+    for (unsigned offset = 1; offset < mWorkerCount; ++offset) {
+        WorkerQueue &victim = mQueues[(workerIndex + offset) % mWorkerCount];
+        std::lock_guard<std::mutex> guard(victim.lock);
+        if (!victim.jobs.empty()) {
+            job = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            return true;
+        }
+    }
+    return false;
+} // END Steal
+
+/****************************************************************************
+Function: WorkerLoop
+Parameter(s): unsigned - Index of this worker.
+Output: N/A
+Comments: Runs jobs until neither the local queue nor any victim has work.
+          No new jobs arrive during a batch, so empty means finished.
+****************************************************************************/
+void WorkStealingPool::WorkerLoop(unsigned workerIndex) {
+    Job job;
+    while (PopLocal(workerIndex, job) || Steal(workerIndex, job)) {
+        job();
+    }
+} // END WorkerLoop
+
+/****************************************************************************
+Function: RunToCompletion
+Parameter(s): N/A
+Output: N/A
+Comments: Runs every submitted job and returns once all of them finished.
+          The calling thread works as worker zero.
+****************************************************************************/
+void WorkStealingPool::RunToCompletion() {
+    std::vector<std::thread> workers;
+    for (unsigned i = 1; i < mWorkerCount; ++i) {
+        workers.push_back(std::thread(&WorkStealingPool::WorkerLoop, this, i));
+    }
+    WorkerLoop(0);
+    for (size_t i = 0; i < workers.size(); ++i) {
+        workers[i].join();
+    }
+} // END RunToCompletion
@@ -0,0 +1,44 @@
+/****************************************************************************
+File: WorkStealingPool.h
+Author: fookenCode
+****************************************************************************/
+#ifndef _WORK_STEALING_POOL_H_
+#define _WORK_STEALING_POOL_H_
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/****************************************************************************
+Class: WorkStealingPool
+Comments: Runs a batch of independent jobs over a fixed set of worker
+          threads.  Every worker owns a queue and takes work from its back;
+          a worker that runs dry steals from the front of another worker's
+          queue, so long-running jobs never leave the other cores idle.
+****************************************************************************/
+class WorkStealingPool {
+public:
+    typedef std::function<void()> Job;
+private:
+    struct WorkerQueue {
+        std::mutex lock;
+        std::deque<Job> jobs;
+    };
+    unsigned mWorkerCount, mNextQueue;
+    std::vector<WorkerQueue> mQueues;
+
+    bool PopLocal(unsigned workerIndex, Job &job);
+    bool Steal(unsigned workerIndex, Job &job);
+    void WorkerLoop(unsigned workerIndex);
+
+    WorkStealingPool(const WorkStealingPool &other);
+    WorkStealingPool &operator=(const WorkStealingPool &other);
+public:
+    WorkStealingPool(unsigned workerCount = 0);
+
+    unsigned getWorkerCount() { return mWorkerCount; }
+    void Submit(const Job &job);
+    void RunToCompletion();
+};
+#endif // _WORK_STEALING_POOL_H_